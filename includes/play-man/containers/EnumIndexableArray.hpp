@@ -20,6 +20,7 @@
 #include <play-man/utility/Concepts.hpp>
 
 #include <array>
+#include <cstddef>
 
 /**
  * @brief Wrapper class of std::array with indexing support for enum classes of type EnumKeyType.
@@ -42,42 +43,42 @@ private:
 
 public:
 
-	reference at(EnumKeyType pos)
+	constexpr reference at(EnumKeyType pos)
 	{
 		return array::at(static_cast<size_t>(pos));
 	}
 
-	const_reference at(EnumKeyType pos) const
+	constexpr const_reference at(EnumKeyType pos) const
 	{
 		return array::at(static_cast<size_t>(pos));
 	}
 
-	reference at(size_t pos)
+	constexpr reference at(size_t pos)
 	{
 		return array::at(pos);
 	}
 
-	const_reference at(size_t pos) const
+	constexpr const_reference at(size_t pos) const
 	{
 		return array::at(pos);
 	}
 
-	reference operator[](EnumKeyType pos)
+	constexpr reference operator[](EnumKeyType pos)
 	{
 		return array::operator[](static_cast<size_t>(pos));
 	}
 
-	const_reference operator[](EnumKeyType pos) const
+	constexpr const_reference operator[](EnumKeyType pos) const
 	{
 		return array::operator[](static_cast<size_t>(pos));
 	}
 
-	reference operator[](size_t pos)
+	constexpr reference operator[](size_t pos)
 	{
 		return array::operator[](pos);
 	}
 
-	const_reference operator[](size_t pos) const
+	constexpr const_reference operator[](size_t pos) const
 	{
 		return array::operator[](pos);
 	}
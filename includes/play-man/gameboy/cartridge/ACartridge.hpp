@@ -19,38 +19,196 @@
 
 #include <play-man/gameboy/cartridge/CartridgeDefines.hpp>
 #include <play-man/gameboy/cartridge/Rom.hpp>
+#include <play-man/gameboy/memory/DirtyPages.hpp>
+#include <play-man/gameboy/savestate/SaveState.hpp>
+#include <filesystem>
 #include <memory>
+#include <variant>
 #include <stdint.h>
 
 namespace GameBoy {
 
+class NoMBCCartridge;
+class MBC1Cartridge;
+class MBC2Cartridge;
+class MBC3Cartridge;
+class MBC5Cartridge;
+
+/**
+ * @brief The concrete mapper of a cartridge, visiting it calls the mapper's functions directly
+ *        instead of through the virtual functions of ACartridge.
+ */
+using CartridgeMapper = std::variant<NoMBCCartridge*, MBC1Cartridge*, MBC2Cartridge*, MBC3Cartridge*, MBC5Cartridge*>;
+
 class ACartridge
 {
 private:
     void    InitRamBanks();
 
 protected:
-    std::unique_ptr<Rom>    rom;
-    MemoryBanks             ramBanks;
+    /**
+     * @brief The ROM is never modified and can be shared with other cartridges, see LoadSharedRom.
+     */
+    std::shared_ptr<const Rom>  rom;
+    MemoryBanks                 ramBanks;
+
+    /**
+     * @brief The path this cartridge was loaded from, which can differ from the shared ROM's path.
+     */
+    std::filesystem::path       filePath;
+
+    /**
+     * @brief The pages of ramBanks written since the consumer last cleared them, see GetRamDirtyPages.
+     */
+    DirtyPages                  ramDirtyPages;
+
+    /**
+     * @brief The memory currently mapped at the ROM and RAM ranges, so reads only have to add the offset.
+     * 
+     * @note Recomputed by UpdateBanks whenever a control register gets written,
+     *       nullptr when the range can not be read, e.g. a non existing bank or disabled RAM.
+     */
+    const uint8_t*  romBank0 = nullptr; /*!< 0x0000-0x3FFF */
+    const uint8_t*  romBankN = nullptr; /*!< 0x4000-0x7FFF */
+    uint8_t*        ramBank = nullptr;  /*!< 0xA000-0xBFFF */
+
+    /**
+     * @brief Recomputes romBank0, romBankN and ramBank from the control registers.
+     */
+    virtual void    UpdateBanks() = 0;
+
+    /**
+     * @brief Writes/reads the mapper's control registers, the part of the state that differs per mapper.
+     *        ValidateRegisters reads past them like LoadRegisters does, without loading them.
+     * 
+     * @note The bank pointers are recomputed by UpdateBanks after loading.
+     */
+    virtual void    SaveRegisters(SaveStateWriter& writer) const = 0;
+    virtual void    LoadRegisters(SaveStateReader& reader) noexcept(false) = 0;
+    virtual void    ValidateRegisters(SaveStateReader& reader) const noexcept(false) = 0;
+
+    /**
+     * @brief Writes a byte of RAM through ramBank, marking its page dirty.
+     */
+    void    WriteRamBank(const uint16_t offset, const uint8_t value)
+    {
+        ramBank[offset] = value;
+        ramDirtyPages.Mark(static_cast<size_t>(ramBank - ramBanks.data()) + offset);
+    }
 
 public:
     ACartridge() = delete;
-    ACartridge(std::unique_ptr<Rom> _rom);
+    ACartridge(std::shared_ptr<const Rom> _rom, std::filesystem::path _filePath);
     virtual ~ACartridge() = default;
 
     virtual uint8_t ReadByte(const uint16_t address) = 0;
     virtual void    WriteByte(const uint16_t address, const uint8_t value) = 0;
 
+    /**
+     * @brief Returns a pointer to the memory currently mapped at the given address,
+     *        allowing the memory bus to read it without going through ReadByte.
+     * 
+     * @note  The pointer stays valid for the rest of the memory page containing the address,
+     *        until the next write to one of the cartridge's control registers.
+     * 
+     * @return nullptr if the address can not be read directly, e.g. when RAM is disabled.
+     */
+    virtual const uint8_t*  GetReadPointer(const uint16_t address) = 0;
+
+    /**
+     * @brief Same as GetReadPointer but for writes, only RAM can be written to directly.
+     * 
+     * @return nullptr if the address can not be written to directly.
+     */
+    virtual uint8_t*        GetWritePointer(const uint16_t address) = 0;
+
+    /**
+     * @brief Returns the concrete mapper of this cartridge, to be resolved once by code that
+     *        accesses the cartridge often.
+     */
+    virtual CartridgeMapper GetMapper() = 0;
+
+    const Rom&      GetRom() const;
+    const std::filesystem::path&    GetFilePath() const;
     CartridgeType   GetType() const;
     uint32_t        GetRamBankCount() const;
     uint32_t        GetRomBankCount() const;
 
+    /**
+     * @return Whether the cartridge type keeps its RAM powered by a battery, see AttachSaveFile.
+     */
+    bool            HasBattery() const;
+
+    /**
+     * @brief Stores the cartridge RAM in the given save file from now on, so it persists between runs.
+     *        The file is memory mapped, writes to the RAM end up in the file without any extra work.
+     * 
+     * @note  The current RAM contents are replaced by those of the file, a new file starts out zeroed.
+     * @note  The RAM moves to a different address, a memory bus using this cartridge has to call
+     *        MapCartridge afterwards.
+     * @note  Does nothing for cartridges without RAM.
+     * 
+     * @note  The file is locked while it is attached, another cartridge (in this or another process)
+     *        attaching the same file fails instead of sharing the RAM.
+     * 
+     * @param filePath The path to the save file, created if it does not exist yet.
+     * @throw std::runtime_error if the file could not be opened or created, or is in use by another cartridge.
+     *        The cartridge keeps its current RAM in that case.
+     */
+    void            AttachSaveFile(const std::filesystem::path& filePath) noexcept(false);
+
+    /**
+     * @brief Writes the RAM back to the save file, does nothing if there is none.
+     *        The save file is also flushed when the cartridge is destroyed.
+     * 
+     * @param wait Whether to block until the data is on disk, otherwise the writeback is only scheduled.
+     */
+    void            FlushSaveFile(bool wait = false);
+
+    /**
+     * @brief Writes the RAM and the control registers of the mapper.
+     */
+    void            SaveState(SaveStateWriter& writer) const;
+
+    /**
+     * @brief Loads the RAM, marking all of it dirty, and the control registers.
+     * 
+     * @note A memory bus using this cartridge has to call MapCartridge afterwards.
+     * @throw std::runtime_error if the state is of a different cartridge type or RAM size.
+     */
+    void            LoadState(SaveStateReader& reader) noexcept(false);
+
+    /**
+     * @brief Reads past the section LoadState would read, checking it without loading anything.
+     * 
+     * @throw std::runtime_error if the state is of a different cartridge type or RAM size, or LoadState would reject it.
+     */
+    void            ValidateState(SaveStateReader& reader) const noexcept(false);
+
+    /**
+     * @brief The pages of the RAM banks written since they were last cleared, indexed by their
+     *        offset into the RAM banks. Writes through both ReadByte/WriteByte and GetWritePointer count,
+     *        the latter as long as the writer marks them with GetRamDirtyMarker.
+     */
+    DirtyPages&         GetRamDirtyPages() { return ramDirtyPages; }
+    const DirtyPages&   GetRamDirtyPages() const { return ramDirtyPages; }
+
+    /**
+     * @brief Returns the marker of the page a pointer returned by GetWritePointer writes to.
+     */
+    DirtyPages::Marker  GetRamDirtyMarker(const uint8_t* writePointer)
+    {
+        return ramDirtyPages.GetMarker(static_cast<size_t>(writePointer - ramBanks.data()));
+    }
+
     /**
      * @brief Only to be used for testing, clears the internal data and replaces it
      *        with the contents of the specified file.
      * 
      * @note  Does not parse the ROM header for easier creations of custom test roms.
      *        Will only use ROM bank 0.
+     * @note  The test data is loaded into a private copy of the ROM, so other cartridges
+     *        sharing the ROM are not affected.
      * 
      * @param filePath The path the the test rom.
      */
@@ -21,21 +21,10 @@
 #include <vector>
 
 #include <play-man/gameboy/memory/MemoryDefines.hpp>
+#include <play-man/gameboy/cartridge/MemoryBanks.hpp>
 
 namespace GameBoy {
 
-    /**
-     * @note Banking: Banking is a way to use the same address space for much more data
-     *       then it should be able to fit. A cartridge contains registers that keep track of
-     *       which bank is activated. Changing the register will change which bank is active
-     *       and where the address will point to, allowing for a lot more memory to be addressed.
-     *       
-     *       Since ROMs are read only (as the name suggest) trying to write to the address space
-     *       connected to it seem counter productive but it will not attempt to write
-     *       into ROM memory, instead it will change a register values inside the cartridge.
-     */
-    using MemoryBanks = std::vector<std::vector<uint8_t>>;
-
     constexpr uint32_t RamBankSize = KiB * 8;
     constexpr uint32_t RomBankSize = KiB * 16;
     constexpr uint32_t MBC2RamSize = 512;
@@ -23,7 +23,7 @@
 
 namespace GameBoy {
 
-class MBC1Cartridge : public ACartridge
+class MBC1Cartridge final : public ACartridge
 {
 private:
     /* Control Registers*/
@@ -99,13 +99,39 @@ private:
      */
     bool CheckMBC1M();
 
+    /**
+     * @brief Returns the ROM bank mapped at 0x0000-0x3FFF.
+     */
+    uint8_t SelectedRomBank0();
+
+    /**
+     * @brief Returns the ROM bank mapped at 0x4000-0x7FFF.
+     */
+    uint8_t SelectedRomBankN();
+
+    /**
+     * @brief Returns the RAM bank mapped at 0xA000-0xBFFF.
+     */
+    uint8_t SelectedRamBank();
+
+    /**
+     * @brief Recomputes the bank pointers from the control registers.
+     */
+    virtual void    UpdateBanks() override;
+    virtual void    SaveRegisters(SaveStateWriter& writer) const override;
+    virtual void    LoadRegisters(SaveStateReader& reader) noexcept(false) override;
+    virtual void    ValidateRegisters(SaveStateReader& reader) const noexcept(false) override;
+
 public:
     MBC1Cartridge() = delete;
-    MBC1Cartridge(std::unique_ptr<Rom> rom); 
+    MBC1Cartridge(std::shared_ptr<const Rom> rom, std::filesystem::path filePath); 
     ~MBC1Cartridge() = default;
 
     virtual uint8_t ReadByte(const uint16_t address) override;
     virtual void    WriteByte(const uint16_t address, const uint8_t value) override;
+    virtual const uint8_t*  GetReadPointer(const uint16_t address) override;
+    virtual uint8_t*        GetWritePointer(const uint16_t address) override;
+    virtual CartridgeMapper GetMapper() override { return this; }
 };
 
 }
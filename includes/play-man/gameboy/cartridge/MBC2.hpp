@@ -22,20 +22,11 @@
 
 namespace GameBoy {
 
-class MBC2Cartridge : public ACartridge
+class MBC2Cartridge final : public ACartridge
 {
 private:
     /* Control Registers */
 
-    /**
-     * @brief The MCB2 Cartridge does not contain external RAM,
-     * rather is has 512 half-bytes of ram baked into the MCB2 chip.
-     * 
-     * @note the upper 4 bits of this RAM is undefined and should not
-     * be relied upon.
-     */
-    std::array<uint8_t, MBC2RamSize>    ram;
-
     /**
      * @brief Bit 8 (least significant bit of the upper address byte) controls
      * if his register is being written to or the ramEnabled register.
@@ -56,13 +47,24 @@ private:
      */
     bool ramEnabled;
 
+    /**
+     * @brief Recomputes the bank pointers from the control registers.
+     */
+    virtual void    UpdateBanks() override;
+    virtual void    SaveRegisters(SaveStateWriter& writer) const override;
+    virtual void    LoadRegisters(SaveStateReader& reader) noexcept(false) override;
+    virtual void    ValidateRegisters(SaveStateReader& reader) const noexcept(false) override;
+
 public:
     MBC2Cartridge() = delete;
-    MBC2Cartridge(std::unique_ptr<Rom> rom);
+    MBC2Cartridge(std::shared_ptr<const Rom> rom, std::filesystem::path filePath);
     ~MBC2Cartridge() = default;
 
     virtual uint8_t ReadByte(const uint16_t address) override;
     virtual void    WriteByte(const uint16_t address, const uint8_t value) override;
+    virtual const uint8_t*  GetReadPointer(const uint16_t address) override;
+    virtual uint8_t*        GetWritePointer(const uint16_t address) override;
+    virtual CartridgeMapper GetMapper() override { return this; }
 };
 
 }
@@ -35,7 +35,7 @@ namespace GameBoy {
 CREATE_ENUM_WITH_UTILS(RTC_REGISTERS_SEQ, RTCRegisters);
 #undef RTC_REGISTERS_SEQ
 
-class MBC3Cartridge : public ACartridge
+class MBC3Cartridge final : public ACartridge
 {
 private:
 
@@ -107,6 +107,13 @@ private:
         uint8_t   GetDaysUpperAndFlagsLatched() const;
         bool      IsHalted() const;
 
+        /**
+         * @brief Writes the internal and latched registers and the system time they were last updated at.
+         */
+        void      SaveState(SaveStateWriter& writer) const;
+        void      LoadState(SaveStateReader& reader) noexcept(false);
+        void      ValidateState(SaveStateReader& reader) const noexcept(false);
+
     };
 
     RealTimeClock RTC;
@@ -181,13 +188,24 @@ private:
      */
     void    WriteRTC(const uint8_t value);
 
+    /**
+     * @brief Recomputes the bank pointers from the control registers.
+     */
+    virtual void    UpdateBanks() override;
+    virtual void    SaveRegisters(SaveStateWriter& writer) const override;
+    virtual void    LoadRegisters(SaveStateReader& reader) noexcept(false) override;
+    virtual void    ValidateRegisters(SaveStateReader& reader) const noexcept(false) override;
+
 public:
     MBC3Cartridge() = delete;
-    MBC3Cartridge(std::unique_ptr<Rom> rom);
+    MBC3Cartridge(std::shared_ptr<const Rom> rom, std::filesystem::path filePath);
     ~MBC3Cartridge() = default;
 
     virtual uint8_t ReadByte(const uint16_t address) override;
     virtual void    WriteByte(const uint16_t address, const uint8_t value) override;
+    virtual const uint8_t*  GetReadPointer(const uint16_t address) override;
+    virtual uint8_t*        GetWritePointer(const uint16_t address) override;
+    virtual CartridgeMapper GetMapper() override { return this; }
 };
 
 }
@@ -22,7 +22,7 @@
 
 namespace GameBoy {
 
-    class MBC5Cartridge : public ACartridge
+    class MBC5Cartridge final : public ACartridge
     {
     private:
         /**
@@ -63,13 +63,24 @@ namespace GameBoy {
          */
         void    DeactivateRumbleMotor();
 
+        /**
+         * @brief Recomputes the bank pointers from the control registers.
+         */
+        virtual void    UpdateBanks() override;
+        virtual void    SaveRegisters(SaveStateWriter& writer) const override;
+        virtual void    LoadRegisters(SaveStateReader& reader) noexcept(false) override;
+        virtual void    ValidateRegisters(SaveStateReader& reader) const noexcept(false) override;
+
     public:
         MBC5Cartridge() = delete;
-        MBC5Cartridge(std::unique_ptr<Rom> rom);
+        MBC5Cartridge(std::shared_ptr<const Rom> rom, std::filesystem::path filePath);
         ~MBC5Cartridge() = default;
 
         virtual uint8_t ReadByte(const uint16_t address) override;
         virtual void    WriteByte(const uint16_t address, const uint8_t value) override;
+        virtual const uint8_t*  GetReadPointer(const uint16_t address) override;
+        virtual uint8_t*        GetWritePointer(const uint16_t address) override;
+        virtual CartridgeMapper GetMapper() override { return this; }
     };
 
 }
@@ -0,0 +1,111 @@
+// ****************************************************************************** //
+//   _______   __                              __       __                        //
+//  /       \ /  |                            /  \     /  |                       //
+//  $$$$$$$  |$$ |  ______   __    __         $$  \   /$$ |  ______   _______     //
+//  $$ |__$$ |$$ | /      \ /  |  /  | ______ $$$  \ /$$$ | /      \ /       \    //
+//  $$    $$/ $$ | $$$$$$  |$$ |  $$ |/      |$$$$  /$$$$ | $$$$$$  |$$$$$$$  |   //
+//  $$$$$$$/  $$ | /    $$ |$$ |  $$ |$$$$$$/ $$ $$ $$/$$ | /    $$ |$$ |  $$ |   //
+//  $$ |      $$ |/$$$$$$$ |$$ \__$$ |        $$ |$$$/ $$ |/$$$$$$$ |$$ |  $$ |   //
+//  $$ |      $$ |$$    $$ |$$    $$ |        $$ | $/  $$ |$$    $$ |$$ |  $$ |   //
+//  $$/       $$/  $$$$$$$/  $$$$$$$ |        $$/      $$/  $$$$$$$/ $$/   $$/    //
+//                          /  \__$$ |                                            //
+//                          $$    $$/                                             //
+//                           $$$$$$/                                              //
+//                                                                                //
+//                            By: K1ngmar and rvan-mee                            //
+// ****************************************************************************** //
+
+#pragma once
+
+#include <play-man/utility/MappedFile.hpp>
+#include <assert.h>
+#include <span>
+#include <stdint.h>
+#include <vector>
+
+namespace GameBoy {
+
+    /**
+     * @brief A set of equally sized memory banks stored back to back in a single buffer,
+     * a bank starts at data() + bank * bankSize.
+     * 
+     * @note Banking: Banking is a way to use the same address space for much more data
+     *       then it should be able to fit. A cartridge contains registers that keep track of
+     *       which bank is activated. Changing the register will change which bank is active
+     *       and where the address will point to, allowing for a lot more memory to be addressed.
+     *       
+     *       Since ROMs are read only (as the name suggest) trying to write to the address space
+     *       connected to it seem counter productive but it will not attempt to write
+     *       into ROM memory, instead it will change a register values inside the cartridge.
+     */
+    class MemoryBanks
+    {
+    private:
+        std::vector<uint8_t>            buffer;
+        Utility::WritableMappedFile     file;
+        uint8_t*                        bytes = nullptr; /*!< Either buffer.data() or file.data() */
+        uint32_t                        bankSize = 0;
+        uint32_t                        bankCount = 0;
+
+    public:
+        MemoryBanks() = default;
+
+        /**
+         * @brief Allocates bankCount zero initialized banks of bankSize bytes.
+         */
+        MemoryBanks(uint32_t _bankCount, uint32_t _bankSize)
+            : buffer(static_cast<size_t>(_bankCount) * _bankSize), bytes(buffer.data()), bankSize(_bankSize), bankCount(_bankCount) {};
+
+        /**
+         * @brief Stores bankCount banks of bankSize bytes in the given file, see Utility::WritableMappedFile.
+         * 
+         * @note Writes to the banks end up in the file without any copying, Flush only has to write them back.
+         * @throws std::runtime_error if the file could not be opened or created.
+         */
+        MemoryBanks(const std::filesystem::path& filePath, uint32_t _bankCount, uint32_t _bankSize) noexcept(false)
+            : file(filePath, static_cast<size_t>(_bankCount) * _bankSize), bytes(file.data()), bankSize(_bankSize), bankCount(_bankCount) {};
+
+        /**
+         * @return Whether the banks are stored in a file.
+         */
+        bool IsFileBacked() const { return file.size() > 0; }
+
+        /**
+         * @brief Writes the banks back to their file, does nothing when they are not file backed.
+         * 
+         * @param wait Whether to block until the data is on disk, otherwise the writeback is only scheduled.
+         */
+        void Flush(bool wait = false) { file.Flush(wait); }
+
+        /**
+         * @return The amount of banks.
+         */
+        uint32_t size() const { return bankCount; }
+
+        /**
+         * @return The size of a single bank in bytes.
+         */
+        uint32_t BankSize() const { return bankSize; }
+
+        /**
+         * @return The size of all banks combined in bytes.
+         */
+        size_t SizeInBytes() const { return static_cast<size_t>(bankCount) * bankSize; }
+
+        uint8_t*        data() { return bytes; }
+        const uint8_t*  data() const { return bytes; }
+
+        std::span<uint8_t> operator[](uint32_t bank)
+        {
+            assert(bank < bankCount);
+            return std::span<uint8_t>(bytes + static_cast<size_t>(bank) * bankSize, bankSize);
+        }
+
+        std::span<const uint8_t> operator[](uint32_t bank) const
+        {
+            assert(bank < bankCount);
+            return std::span<const uint8_t>(bytes + static_cast<size_t>(bank) * bankSize, bankSize);
+        }
+    };
+
+}
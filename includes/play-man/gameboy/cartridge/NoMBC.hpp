@@ -28,18 +28,29 @@ namespace GameBoy {
      * Could optionally contain RAM by using a discrete logic decoder instead
      * of a full memory bank controller chip.
      */
-    class NoMBCCartridge : public ACartridge
+    class NoMBCCartridge final : public ACartridge
     {
     private:
         bool hasRam;
     
+        /**
+         * @brief Points the bank pointers at the ROM and RAM, which are never switched.
+         */
+        virtual void    UpdateBanks() override;
+        virtual void    SaveRegisters(SaveStateWriter& writer) const override;
+        virtual void    LoadRegisters(SaveStateReader& reader) noexcept(false) override;
+        virtual void    ValidateRegisters(SaveStateReader& reader) const noexcept(false) override;
+
     public:
         NoMBCCartridge() = delete;
-        NoMBCCartridge(std::unique_ptr<Rom> rom);
+        NoMBCCartridge(std::shared_ptr<const Rom> rom, std::filesystem::path filePath);
         ~NoMBCCartridge() = default;
 
         virtual uint8_t ReadByte(const uint16_t address) override;
         virtual void    WriteByte(const uint16_t address, const uint8_t value) override;
+        virtual const uint8_t*  GetReadPointer(const uint16_t address) override;
+        virtual uint8_t*        GetWritePointer(const uint16_t address) override;
+        virtual CartridgeMapper GetMapper() override { return this; }
     };
 
 }
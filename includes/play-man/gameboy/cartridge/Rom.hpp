@@ -19,7 +19,10 @@
 
 #include <play-man/gameboy/cartridge/RomHeaderDefines.hpp>
 #include <play-man/gameboy/cartridge/CartridgeDefines.hpp>
+#include <play-man/utility/MappedFile.hpp>
 #include <array>
+#include <filesystem>
+#include <span>
 #include <vector>
 #include <stdint.h>
 #include <ostream>
@@ -46,9 +49,9 @@ class RomHeader {
         /**
          * @brief Parses the data given and sets all the RomHeader values.
          * 
-         * @param data A vector that contains the raw data from a ROM. 
+         * @param data The raw data from a ROM. 
          */
-        void Init(const std::vector<uint8_t>& data);
+        void Init(std::span<const uint8_t> data);
 };
 
 std::ostream& operator << (std::ostream& lhs, const RomHeader& header);
@@ -56,25 +59,75 @@ std::ostream& operator << (std::ostream& lhs, const RomHeader& header);
 class Rom
 {
     private:
-        RomHeader   header;
-        MemoryBanks romBanks;
-        const char* filePath;
+        RomHeader           header;
 
-        void InitRomBanks(std::vector<uint8_t>& rawRomData);
+        /**
+         * @brief The path the ROM was first loaded from, cartridges sharing the ROM
+         * keep their own path, see ACartridge::GetFilePath.
+         */
+        std::filesystem::path filePath;
+
+        /**
+         * @brief The ROM file, the banks are read straight from it if it contains all of them.
+         */
+        Utility::MappedFile image;
+
+        /**
+         * @brief Only used when the banks can not be read from the image directly,
+         * e.g. for files smaller than stated in their header or after LoadTestRom.
+         */
+        MemoryBanks         romBanks;
+
+        /**
+         * @brief Start of bank 0, pointing into either the image or romBanks.
+         */
+        const uint8_t*      romData = nullptr;
+        uint32_t            romDataBankCount = 0;
+
+        void InitRomBanks();
+
+        /**
+         * @brief Copies the image into romBanks, padding it with zeroes up to bankCount banks,
+         * and releases the image.
+         */
+        void CopyImageToBanks(uint32_t bankCount);
 
     public:
         Rom() = delete;
         Rom(const char* romFilePath) noexcept(false);
 
+        /**
+         * @param romFilePath The path the image was opened from.
+         * @param romImage The already opened ROM file, see OpenFile.
+         */
+        Rom(const char* romFilePath, Utility::MappedFile&& romImage);
+
+        /**
+         * @brief Creates a private, writable copy of the given ROM's data.
+         */
+        Rom(const Rom& other);
+        Rom& operator=(const Rom& other) = delete;
+
+        /**
+         * @brief Opens the given ROM file without parsing it.
+         * @throws std::runtime_error if the file could not be opened.
+         */
+        static Utility::MappedFile  OpenFile(const char* romFilePath) noexcept(false);
+
         const RomHeader&                GetHeader() const;
-        const MemoryBanks&              GetBanks() const;
-        const char*                     GetFilePath() const;
+        std::span<const uint8_t>        GetData() const;
+        const std::filesystem::path&    GetFilePath() const;
         CartridgeType                   GetCartridgeType() const;
         uint32_t                        GetRomBankCount() const;
         uint32_t                        GetRamBankCount() const;
 
         uint8_t                         ReadFromBank(uint32_t bank, uint16_t address) const;
 
+        /**
+         * @brief Returns a pointer to the first byte of the given bank.
+         */
+        const uint8_t*                  GetBankData(uint32_t bank) const;
+
         /**
          * @brief Only to be used for testing, clears the internal data and replaces it
          *        with the contents of the specified file.
@@ -88,6 +141,6 @@ class Rom
 
 };
 
-std::ostream& operator << (std::ostream& lhs, Rom& rom);
+std::ostream& operator << (std::ostream& lhs, const Rom& rom);
 
 };
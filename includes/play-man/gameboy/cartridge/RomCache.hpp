@@ -15,43 +15,32 @@
 //                            By: K1ngmar and rvan-mee                            //
 // ****************************************************************************** //
 
-#include <play-man/gameboy/cpu/Register.hpp>
-
-namespace GameBoy
-{
-	Register::Register(uint16_t initialValue)
-	{
-		internalRegister.value = initialValue;
-	}
-
-	void Register::SetLowByte(uint8_t value)
-	{
-		internalRegister.byte.low = value;
-	}
-
-	void Register::SetHighByte(uint8_t value)
-	{
-		internalRegister.byte.high = value;
-	}
-
-	void Register::SetValue(uint16_t value)
-	{
-		internalRegister.value = value;
-	}
-
-	uint8_t Register::LowByte() const
-	{
-		return internalRegister.byte.low;
-	}
-
-	uint8_t Register::HighByte() const
-	{
-		return internalRegister.byte.high;
-	}
-
-	uint16_t Register::Value() const
-	{
-		return internalRegister.value;
-	}
+#pragma once
+
+#include <play-man/gameboy/cartridge/Rom.hpp>
+#include <memory>
+
+namespace GameBoy {
+
+/**
+ * @brief Loads the ROM located at filePath, ROMs are cached process wide,
+ *        so every cartridge loading the same ROM shares a single read only image.
+ * 
+ * @note  A file that is already loaded is recognized by its identity (device, inode, size and
+ *        modification time) without reading it. Only a file that is not in the cache yet gets read
+ *        and compared by its contents, so copies of a ROM at other paths are shared as well.
+ * @note  The cache only holds weak references, a ROM is released once the last cartridge using it is gone.
+ *        The entries of released ROMs are dropped whenever a ROM that is not cached yet gets loaded.
+ * @note  Thread safe.
+ * 
+ * @param filePath The path where the ROM is located
+ * @throw std::runtime_error if the file could not be opened.
+ */
+std::shared_ptr<const Rom> LoadSharedRom(const char* filePath) noexcept(false);
+
+/**
+ * @brief The amount of entries in the ROM cache, including those of released ROMs that have not been dropped yet.
+ */
+size_t GetRomCacheSize();
 
 }
@@ -0,0 +1,104 @@
+// ****************************************************************************** //
+//   _______   __                              __       __                        //
+//  /       \ /  |                            /  \     /  |                       //
+//  $$$$$$$  |$$ |  ______   __    __         $$  \   /$$ |  ______   _______     //
+//  $$ |__$$ |$$ | /      \ /  |  /  | ______ $$$  \ /$$$ | /      \ /       \    //
+//  $$    $$/ $$ | $$$$$$  |$$ |  $$ |/      |$$$$  /$$$$ | $$$$$$  |$$$$$$$  |   //
+//  $$$$$$$/  $$ | /    $$ |$$ |  $$ |$$$$$$/ $$ $$ $$/$$ | /    $$ |$$ |  $$ |   //
+//  $$ |      $$ |/$$$$$$$ |$$ \__$$ |        $$ |$$$/ $$ |/$$$$$$$ |$$ |  $$ |   //
+//  $$ |      $$ |$$    $$ |$$    $$ |        $$ | $/  $$ |$$    $$ |$$ |  $$ |   //
+//  $$/       $$/  $$$$$$$/  $$$$$$$ |        $$/      $$/  $$$$$$$/ $$/   $$/    //
+//                          /  \__$$ |                                            //
+//                          $$    $$/                                             //
+//                           $$$$$$/                                              //
+//                                                                                //
+//                            By: K1ngmar and rvan-mee                            //
+// ****************************************************************************** //
+
+#pragma once
+
+#include <array>
+#include <stdint.h>
+
+/**
+ * @brief Flag and result tables of the 8 bit ALU, built at compile time.
+ * 
+ * @note The flags are packed like inside the F register: zero 0x80, sub 0x40, half carry 0x20 and carry 0x10.
+ * @note ADD/ADC/SUB/SBC/CP have no table: indexed by both operands and the carry their table would be
+ *       128 KiB, which does not stay in the cache, while the flags are only a few shifts of
+ *       base ^ operand ^ result away, see CpuCore::ComputeFlags.
+ */
+namespace GameBoy::AluTables
+{
+	constexpr uint8_t zeroFlag = 0b1000'0000;
+	constexpr uint8_t subFlag = 0b0100'0000;
+	constexpr uint8_t halfCarryFlag = 0b0010'0000;
+	constexpr uint8_t carryFlag = 0b0001'0000;
+
+	/**
+	 * @brief Builds the flags of INC (decrement = false) or DEC (decrement = true) indexed by the result,
+	 *        the carry flag is not affected and left out.
+	 */
+	constexpr std::array<uint8_t, 256> MakeIncrementFlagTable(bool decrement)
+	{
+		std::array<uint8_t, 256> table {};
+
+		for (uint32_t result = 0; result < table.size(); result++)
+		{
+			// INC half carries into 0x?0, DEC borrows into 0x?F.
+			const bool halfCarry = (result & 0xF) == (decrement ? 0xF : 0x0);
+
+			table[result] = (decrement ? subFlag : 0)
+				| (halfCarry ? halfCarryFlag : 0)
+				| (result == 0 ? zeroFlag : 0);
+		}
+		return table;
+	}
+
+	/**
+	 * @brief Index into decimalAdjust.
+	 * @param a The A register.
+	 * @param flags The F register, only sub, half carry and carry are used.
+	 */
+	constexpr uint16_t DecimalAdjustIndex(uint8_t a, uint8_t flags)
+	{
+		return static_cast<uint16_t>((((flags >> 4) & 0b111) << 8) | a);
+	}
+
+	/**
+	 * @brief Builds the result of DAA for every DecimalAdjustIndex, as the new value of the AF register:
+	 *        the adjusted A in the high byte and the flags in the low byte.
+	 * 
+	 * @note https://blog.ollien.com/posts/gb-daa/
+	 */
+	constexpr std::array<uint16_t, 2048> MakeDecimalAdjustTable()
+	{
+		std::array<uint16_t, 2048> table {};
+
+		for (uint32_t index = 0; index < table.size(); index++)
+		{
+			const uint8_t value = index & 0xFF;
+			const bool carry = (index >> 8) & 0b001;
+			const bool halfCarry = (index >> 8) & 0b010;
+			const bool sub = (index >> 8) & 0b100;
+			uint8_t offset = 0;
+
+			if ((!sub && (value & 0xF) > 0x09) || halfCarry)
+				offset |= 0x06;
+			if ((!sub && value > 0x99) || carry)
+				offset |= 0x60;
+
+			const uint8_t result = sub ? value - offset : value + offset;
+			const uint8_t flags = (sub ? subFlag : 0)
+				| ((offset & 0x60) ? carryFlag : 0)
+				| (result == 0 ? zeroFlag : 0);
+
+			table[index] = static_cast<uint16_t>((result << 8) | flags);
+		}
+		return table;
+	}
+
+	inline constexpr std::array<uint8_t, 256>	incrementFlags = MakeIncrementFlagTable(false);
+	inline constexpr std::array<uint8_t, 256>	decrementFlags = MakeIncrementFlagTable(true);
+	inline constexpr std::array<uint16_t, 2048>	decimalAdjust = MakeDecimalAdjustTable();
+}
@@ -0,0 +1,123 @@
+// ****************************************************************************** //
+//   _______   __                              __       __                        //
+//  /       \ /  |                            /  \     /  |                       //
+//  $$$$$$$  |$$ |  ______   __    __         $$  \   /$$ |  ______   _______     //
+//  $$ |__$$ |$$ | /      \ /  |  /  | ______ $$$  \ /$$$ | /      \ /       \    //
+//  $$    $$/ $$ | $$$$$$  |$$ |  $$ |/      |$$$$  /$$$$ | $$$$$$  |$$$$$$$  |   //
+//  $$$$$$$/  $$ | /    $$ |$$ |  $$ |$$$$$$/ $$ $$ $$/$$ | /    $$ |$$ |  $$ |   //
+//  $$ |      $$ |/$$$$$$$ |$$ \__$$ |        $$ |$$$/ $$ |/$$$$$$$ |$$ |  $$ |   //
+//  $$ |      $$ |$$    $$ |$$    $$ |        $$ | $/  $$ |$$    $$ |$$ |  $$ |   //
+//  $$/       $$/  $$$$$$$/  $$$$$$$ |        $$/      $$/  $$$$$$$/ $$/   $$/    //
+//                          /  \__$$ |                                            //
+//                          $$    $$/                                             //
+//                           $$$$$$/                                              //
+//                                                                                //
+//                            By: K1ngmar and rvan-mee                            //
+// ****************************************************************************** //
+
+#pragma once
+
+#include <play-man/gameboy/cpu/Instruction.hpp>
+#include <play-man/gameboy/memory/MemoryDefines.hpp>
+
+#include <array>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace GameBoy
+{
+	/**
+	 * @brief An instruction inside a decoded block.
+	 */
+	struct DecodedInstruction
+	{
+		Instruction::InstructionPrototype execute; /*!< The handler, nullptr marks the end of the block. */
+		uint8_t opCodeLength; /*!< Amount of opcode bytes to skip before calling the handler, it fetches its own immediate data. */
+		uint8_t length; /*!< Amount of bytes of the whole instruction, including its immediate data. */
+	};
+
+	/**
+	 * @brief A block translated to host machine code, executes until the block ends, the code generation
+	 *        changes or at least cycleBudget cycles have passed.
+	 * @note Adds the cycles of every instruction to the cpu's cycle counter, like the replay loop.
+	 */
+	using NativeBlock = void (*)(Cpu* cpu, size_t cycleBudget);
+
+	/**
+	 * @brief A straight-line run of decoded instructions.
+	 */
+	struct DecodedBlock
+	{
+		std::vector<DecodedInstruction> instructions; /*!< Terminated by an instruction without handler. */
+		bool writable = false; /*!< Whether the block was decoded from writable memory. */
+		bool idleLoop = false; /*!< Whether the block only polls the interrupt flags, see Cpu::DispatchBlocks. */
+
+#if defined(PLAY_MAN_JIT)
+		uint32_t executions = 0; /*!< How often the block has been entered, used to find hot blocks. */
+		NativeBlock native = nullptr; /*!< The translated block, nullptr while it is not hot (or can not be translated). */
+#endif
+	};
+
+	/**
+	 * @brief Stores straight-line runs of decoded instructions (basic blocks).
+	 * 
+	 * @note Blocks are keyed by the host memory they were decoded from instead of the address,
+	 *       which makes every ROM and RAM bank mapped at an address a separate key.
+	 */
+	class BlockCache
+	{
+		/**
+		 * @brief The blocks decoded from a single memory page, indexed by the offset of their first instruction.
+		 */
+		struct PageBlocks
+		{
+			std::array<std::unique_ptr<DecodedBlock>, memoryPageSize> blocks;
+			bool writable = false; /*!< Whether the page's memory can be written, those blocks get flushed on code generation changes. */
+		};
+
+		std::unordered_map<const uint8_t*, std::unique_ptr<PageBlocks>> pages;
+
+		/**
+		 * @brief The last page that got looked up, hot loops rarely leave their page.
+		 */
+		const uint8_t* lastPage = nullptr;
+		PageBlocks* lastPageBlocks = nullptr;
+
+		/**
+		 * @brief Returns the blocks decoded from the given page, or nullptr if none have been decoded.
+		 */
+		PageBlocks* FindPage(const uint8_t* page);
+
+	public:
+
+		/**
+		 * @brief Returns the block starting at the offset inside the page, nullptr if the block has not been decoded.
+		 * @param page The host memory of the page the block starts in.
+		 * @param offset The offset of the first instruction inside the page.
+		 */
+		DecodedBlock* Find(const uint8_t* page, uint8_t offset);
+
+		/**
+		 * @brief Stores the block and returns it, the block stays valid until it gets flushed.
+		 * 
+		 * @param page The host memory of the page the block starts in.
+		 * @param offset The offset of the first instruction inside the page.
+		 * @param instructions The decoded instructions, without terminator.
+		 * @param writable Whether the page's memory can be written.
+		 */
+		DecodedBlock* Insert(const uint8_t* page, uint8_t offset, std::span<const DecodedInstruction> instructions, bool writable);
+
+		/**
+		 * @brief Removes all blocks decoded from writable memory.
+		 */
+		void FlushWritable();
+
+		/**
+		 * @brief Removes all blocks, has to be called when the memory the blocks were decoded from gets replaced.
+		 */
+		void Clear();
+	};
+
+} /* namespace GameBoy */
@@ -21,41 +21,187 @@
 #include <play-man/gameboy/memory/MemoryBus.hpp>
 #include <play-man/gameboy/opcodes/Opcodes.hpp>
 #include <play-man/gameboy/cpu/Instruction.hpp>
+#include <play-man/gameboy/cpu/BlockCache.hpp>
+#include <play-man/gameboy/cpu/Jit.hpp>
+#include <play-man/gameboy/cpu/TimingPolicy.hpp>
+#include <play-man/gameboy/scheduler/Scheduler.hpp>
+#include <play-man/gameboy/timer/Timer.hpp>
 #include <play-man/containers/EnumIndexableArray.hpp>
+#include <play-man/settings/PlayManSettings.hpp>
 
-#include <functional>
+#include <limits>
+#include <span>
 #include <stdint.h>
+#include <vector>
 
 namespace GameBoy
 {	
+    /**
+     * @brief The amount of machine cycles (M-cycles) it takes to draw a single frame.
+     */
+    constexpr size_t machineCyclesPerFrame = 17'556;
+
     class Cpu
     {
         friend struct TestFixtures::GameBoyCpuFixture;
+        friend class Jit;
 
         using InstructionPrototype = Instruction::InstructionPrototype; /*!< -. */
+
+        static constexpr size_t numberOfInstructions = 256;
+        static constexpr size_t numberOfPrefixedInstructions = 256;
+
+        using InstructionTable = EnumIndexableArray<OpCode, InstructionPrototype, numberOfInstructions>; /*!< -. */
+        using PrefixedInstructionTable = EnumIndexableArray<PrefixedOpCode, InstructionPrototype, numberOfPrefixedInstructions>; /*!< -. */
     
     private:
         std::shared_ptr<ACartridge>     cartridge;
         CpuCore                         core;
-        MemoryBus                       memoryBus;
 
-        size_t cycles = 0;
+        size_t cycles = 0; /*!< Kept up to date after every instruction (every memory access with AccurateTiming), the clock of the other components. */
+        size_t sliceEnd = 0; /*!< The cycle the current slice of Run ends, nothing is scheduled before it. 0 outside of Run. */
+        bool halted = false; /*!< Set by HALT, until an enabled interrupt gets requested. */
+        Scheduler scheduler; /*!< The events of the other components, timed in cpu cycles. */
+        Timer timer;
+
+        MemoryBus                       memoryBus;
         Instruction currentInstruction; /*< The current instruction to execute/is being executed. */
 
-        static constexpr size_t numberOfInstructions = 256;
-        static constexpr size_t numberOfPrefixedInstructions = 256;
+        /**
+         * @brief Decoded basic blocks, only used when the block cache execution mode is enabled.
+         */
+        BlockCache  blockCache;
+        bool        blockCacheEnabled = false;
+        TimingAccuracy timingAccuracy = TimingAccuracy::Fast;
+        uint32_t    blockCacheGeneration = 0; /*!< The memory bus' writable code generation the cached blocks are valid for. */
+        std::vector<DecodedInstruction> decodeBuffer;
 
-        EnumIndexableArray<OpCode, InstructionPrototype, numberOfInstructions> instructions;
-        EnumIndexableArray<PrefixedOpCode, InstructionPrototype, numberOfPrefixedInstructions> prefixedInstructions;
+#if defined(PLAY_MAN_JIT)
+        Jit         jit; /*!< Translates hot blocks when the block cache execution mode is enabled. */
+#endif
 
-    public:
+        /**
+         * @brief The instruction tables are built at compile time and shared by every Cpu,
+         *        constructing a Cpu does not allocate or bind anything.
+         */
+        static const InstructionTable instructions;
+        static const PrefixedInstructionTable prefixedInstructions;
 
-        Cpu() = delete;
-        Cpu(std::shared_ptr<ACartridge> _cartridge) : cartridge(_cartridge), memoryBus(cartridge, core)
+        /**
+         * @brief Entry of the instruction tables, calls Implementation with the arguments baked in at compile time.
+         * 
+         * @tparam Implementation Pointer to the member function implementing the instruction.
+         * @tparam Arguments The (register) arguments the instruction is executed with.
+         * 
+         * @return number of cycles.
+         */
+        template<auto Implementation, auto... Arguments>
+        static size_t Invoke(Cpu* cpu)
+        {
+            return (cpu->*Implementation)(Arguments...);
+        }
+
+        /**
+         * @brief Builds the table of non prefixed instructions.
+         */
+        static constexpr InstructionTable MakeInstructionTable();
+
+        /**
+         * @brief Decodes a prefixed (0xCB) opcode from its bit fields into the handler specialized for it.
+         * 
+         * @tparam opCode The prefixed opcode.
+         */
+        template<uint8_t opCode>
+        static constexpr InstructionPrototype MakePrefixedInstruction();
+
+        /**
+         * @brief Builds the table of prefixed (0xCB) instructions, generated from the opcode bit fields.
+         */
+        static constexpr PrefixedInstructionTable MakePrefixedInstructionTable();
+
+        /**
+         * @brief Type erased predicate used by RunUntil, checked before every instruction.
+         */
+        struct StopCondition
         {
-            InitInstructionTable();
+            bool (*shouldStop)(void* context) = nullptr;
+            void* context = nullptr;
         };
 
+        /**
+         * @brief The fetch/execute loop shared by RunFor and RunUntil.
+         * 
+         * @tparam CheckStopCondition Whether stopCondition needs to be checked, RunFor does not pay for it.
+         * @tparam Timing FastTiming or AccurateTiming, how the executed instructions advance the cycle counter.
+         * 
+         * @param cycleBudget The minimum amount of cycles to execute.
+         * @param stopCondition Stops the execution early once it returns true.
+         * 
+         * @return The amount of cycles that have actually been executed.
+         */
+        template<bool CheckStopCondition, typename Timing>
+        size_t Dispatch(size_t cycleBudget, StopCondition stopCondition);
+
+        /**
+         * @brief Runs the cpu in slices that end at the scheduler's next deadline, and the due events
+         *        in between, so the components only get control when one of their events fires.
+         * 
+         * @tparam CheckStopCondition Whether stopCondition needs to be checked.
+         * @tparam Timing FastTiming or AccurateTiming, each policy is a separate instantiation of the
+         *         dispatch loops so the fast one does not pay for timing the memory accesses.
+         * 
+         * @note The block cache is only used with FastTiming, its blocks bypass the memory bus.
+         * 
+         * @param cycleBudget The minimum amount of cycles to execute.
+         * @param stopCondition Stops the execution early once it returns true.
+         * 
+         * @return The amount of cycles that have actually been executed.
+         */
+        template<bool CheckStopCondition, typename Timing>
+        size_t Run(size_t cycleBudget, StopCondition stopCondition);
+
+        /**
+         * @brief Same as Dispatch, but replays the predecoded block starting at PC instead of
+         *        fetching and decoding every instruction.
+         * 
+         * @note Stops in the middle of a block once the budget is used or the stop condition is met,
+         *       so both modes execute exactly the same instructions.
+         * @note Loops polling the interrupt flags (see IsIdleLoop) are fast-forwarded to the end of the
+         *       slice, the blocks are cached per page and offset, and so per bank and address.
+         */
+        template<bool CheckStopCondition>
+        size_t DispatchBlocks(size_t cycleBudget, StopCondition stopCondition);
+
+        /**
+         * @brief Returns the block starting at PC, decoding it when it has not been decoded before.
+         * 
+         * @return nullptr when the code at PC can not be cached, the instruction then has to be
+         *         executed through the regular fetch/decode path.
+         */
+        DecodedBlock* FindOrDecodeBlock();
+
+        /**
+         * @brief Drops all decoded (and translated) blocks.
+         */
+        void ClearBlockCache();
+
+        /**
+         * @brief Fetches, decodes and executes the instruction at PC.
+         * @return number of cycles.
+         */
+        size_t FetchAndExecute();
+
+        /**
+         * @brief Reads through the whole state the way LoadState does, without loading anything.
+         * @throw std::runtime_error if LoadState would reject any part of the state.
+         */
+        void ValidateState(std::span<const uint8_t> data) const noexcept(false);
+
+    public:
+
+        Cpu() = delete;
+        Cpu(std::shared_ptr<ACartridge> _cartridge) : cartridge(_cartridge), timer(core, scheduler, cycles), memoryBus(cartridge, core, timer) {};
+
         /**
          * @brief Used for testing, overwrites the current ROM data with the data
          *        found inside the file at filePath. Also resets all the internal registers.
@@ -99,6 +245,7 @@ namespace GameBoy
 
         /**
          * @brief Reads byte from memory bus at address contained in PC; increments PC;
+         * @note Reads through the memory bus' cached fetch page.
          * @return 
          */
         uint8_t FetchPcAddress();
@@ -113,9 +260,91 @@ namespace GameBoy
         uint16_t FetchPcAddress16bit();
 
         /**
-         * @brief Initializes the instruction array.
+         * @brief Fetches and executes instructions until at least the given amount of cycles have passed.
+         * 
+         * @note Depending on the build the portable dispatch loop or the threaded (computed goto)
+         *       dispatch core is used, see PLAY_MAN_THREADED_DISPATCH.
+         * @note Does not trace the executed instructions, use FetchInstruction and ExecuteInstruction for that.
+         * @note Scheduled events are handled as soon as the instruction reaching their deadline has finished.
+         * 
+         * @param cycleBudget The minimum amount of cycles to execute.
+         * 
+         * @return The amount of cycles that have actually been executed.
+         */
+        size_t RunFor(size_t cycleBudget);
+
+        /**
+         * @brief Returns the amount of cycles the cpu has executed, the clock the scheduler's deadlines refer to.
+         */
+        size_t GetCycles() const
+        {
+            return cycles;
+        }
+
+        /**
+         * @brief Returns the scheduler of the events the other components use to synchronize with the cpu.
+         */
+        Scheduler& GetScheduler()
+        {
+            return scheduler;
+        }
+
+        /**
+         * @brief Enables or disables the block cache execution mode, in which straight-line runs of
+         *        instructions are decoded once and replayed from then on.
+         * 
+         * @note Blocks decoded from RAM are invalidated when the memory they were decoded from gets written.
+         * @note In builds with PLAY_MAN_JIT hot blocks are translated to host machine code as well.
+         */
+        void SetBlockCacheEnabled(bool enabled);
+
+        /**
+         * @brief Selects how precisely the memory accesses are timed, see TimingAccuracy.
+         * 
+         * @note With TimingAccuracy::Accurate every memory access goes through the memory bus' slow path.
+         */
+        void SetTimingAccuracy(TimingAccuracy accuracy);
+
+        /**
+         * @brief Writes the state of the whole machine to buffer, replacing its contents, see SaveStateWriter.
+         * 
+         * @note Has to be called in between RunFor/RunUntil calls. Materializes the lazily computed flags.
+         * @note Reusing the buffer for every save avoids allocating, the state is mostly raw memory.
+         */
+        void SaveState(std::vector<uint8_t>& buffer);
+
+        /**
+         * @brief Restores the state of the whole machine from a state written by SaveState.
+         * 
+         * @note The cartridge has to be of the same type as the one the state was saved with,
+         *       the settings (timing accuracy, block cache) are not part of the state.
+         * 
+         * @throw std::runtime_error if the data is not a valid state of this version and machine,
+         *        the whole state is validated before loading so the machine is left unchanged in that case.
          */
-        void InitInstructionTable();
+        void LoadState(std::span<const uint8_t> data) noexcept(false);
+
+        /**
+         * @brief Fetches and executes instructions until the predicate returns true or the cycle limit
+         *        has been reached, the predicate is checked before every instruction.
+         * 
+         * @param predicate Callable without arguments returning true once the execution should stop.
+         * @param cycleLimit The maximum amount of cycles to execute, the last instruction can exceed it.
+         * 
+         * @return The amount of cycles that have actually been executed.
+         */
+        template<typename Predicate>
+        size_t RunUntil(Predicate predicate, size_t cycleLimit = std::numeric_limits<size_t>::max())
+        {
+            const auto shouldStop = [](void* context) -> bool
+            {
+                return (*static_cast<Predicate*>(context))();
+            };
+
+            if (timingAccuracy == TimingAccuracy::Accurate)
+                return Run<true, AccurateTiming>(cycleLimit, StopCondition { shouldStop, &predicate });
+            return Run<true, FastTiming>(cycleLimit, StopCondition { shouldStop, &predicate });
+        }
 
 //////////////////
 // Instructions //
@@ -133,6 +362,19 @@ private:
 		 */
         size_t NOP();
 
+        /**
+         * @brief Halts the cpu until an enabled interrupt gets requested.
+         * 
+         * @note Only scheduled events request interrupts, so instead of idling cycle by cycle
+         *       the halted cpu skips to the end of the current slice, which ends at the next event.
+         *       Outside of Run there is no slice, the skip then happens in the next Run.
+         * @note Interrupt handling (IME) is not implemented yet, an enabled interrupt that is already
+         *       requested makes HALT a NOP and waking up continues after the HALT.
+         * 
+         * @return number of cycles.
+         */
+        size_t Halt();
+
         /**
          * @brief Adjusts the A register to a binary-coded decimal number.
          * 
@@ -258,45 +500,50 @@ private:
         /**
          * @brief Loads the contents 16 bits of fromReg into toReg.
          * 
-         * @param destReg  Pointer to the register where the data is loaded into.
-         * @param fromReg  Pointer to the register where the data is taken from.
+         * @tparam destReg  Pointer to the register where the data is loaded into.
+         * @tparam fromReg  Pointer to the register where the data is taken from.
          * 
          * @return number of cycles.
          */
-        size_t Load_16bit(RegisterPointer destReg, RegisterPointer fromReg);
+        template<RegisterPointer destReg, RegisterPointer fromReg>
+        size_t Load_16bit();
 
 		/**
 		 * @brief Loads two bytes of immediate data into reg.
 		 * 		  First byte of immediate data is low byte.
-		 * @param reg 
+		 * @tparam reg 
 		 * @return size_t 
 		 */
-		size_t Load_16bit_ImmediateData(RegisterPointer reg);
+		template<RegisterPointer reg>
+		size_t Load_16bit_ImmediateData();
 
         /**
          * @brief Increments the 16 bit register by 1.
          * 
-         * @param reg Pointer to the register needing to be incremented.
+         * @tparam reg Pointer to the register needing to be incremented.
          * @return number of cycles.
          */
-        size_t Increment_16bit(RegisterPointer reg);
+        template<RegisterPointer reg>
+        size_t Increment_16bit();
 
         /**
          * @brief Decrements the 16 bit register by 1.
          * 
-         * @param reg Pointer to the register needing to be decremented.
+         * @tparam reg Pointer to the register needing to be decremented.
          * @return number of cycles.
          */
-        size_t Decrement_16bit(RegisterPointer reg);
+        template<RegisterPointer reg>
+        size_t Decrement_16bit();
 
         /**
          * @brief Loads the contents of the 16bit register to the address found at PC.
          * 
-         * @param reg Pointer to the register where the data is taken from.
+         * @tparam reg Pointer to the register where the data is taken from.
          * 
          * @return number of cycles.
          */
-        size_t Load_16bit_RegToImmediateAddr(RegisterPointer reg);
+        template<RegisterPointer reg>
+        size_t Load_16bit_RegToImmediateAddr();
 
         /**
          * @brief Adds the contents from fromReg to the toReg.
@@ -307,7 +554,8 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t Add_16bit(RegisterPointer toReg, RegisterPointer fromReg);
+        template<RegisterPointer toReg, RegisterPointer fromReg>
+        size_t Add_16bit();
 
         /**
          * @brief Adds the 8 bit signed value found at the program counter (PC) to the
@@ -320,7 +568,8 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t Add_16bit_8bitSignedImmediateData(RegisterPointer reg);
+        template<RegisterPointer reg>
+        size_t Add_16bit_8bitSignedImmediateData();
 
         /**
          * @brief Pushes the 16 bit value found inside reg to the stack, after which the
@@ -328,7 +577,8 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t Push(RegisterPointer reg);
+        template<RegisterPointer reg>
+        size_t Push();
 
         /**
          * @brief Pops the 16 bit value found at the address stored inside StackPointer (SP)
@@ -336,7 +586,8 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t Pop(RegisterPointer reg);
+        template<RegisterPointer reg>
+        size_t Pop();
 
         /**
          * @brief The 'Restart' instruction. Pushes the current program counter (PC) to the stack
@@ -353,8 +604,8 @@ private:
         /**
          * @brief Adds the contents from fromReg to the accumulator register.
          * 
-         * @param opReg Pointer to the register that will be used as the operand.
-         * @param GetValue Pointer to the operand register's member function that will take the
+         * @tparam opReg Pointer to the register that will be used as the operand.
+         * @tparam GetValue Pointer to the operand register's member function that will take the
          *                 High or Low part of the register. 
          * 
          * @note Sets the Z flag according to the calculation.
@@ -364,12 +615,13 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t Add_8bit(RegisterPointer opReg, RegisterGet8Bit GetValue);
+        template<RegisterPointer opReg, RegisterGet8Bit GetValue>
+        size_t Add_8bit();
 
         /**
          * @brief Adds the contents from memory location addrReg to the accumulator register.
          * 
-         * @param addrReg Pointer to the register which contains the location of 
+         * @tparam addrReg Pointer to the register which contains the location of 
          *                the memory that will be used for the addition.
          * 
          * @note Sets the Z flag according to the calculation.
@@ -379,7 +631,8 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t Add_8bit_Addr(RegisterPointer addrReg);
+        template<RegisterPointer addrReg>
+        size_t Add_8bit_Addr();
 
         /**
          * @brief Adds the 8 bit immediate data found at the memory location stored
@@ -398,8 +651,8 @@ private:
          * @brief Adds the contents from opReg to the accumulator register, combined with the 
          *        contents of the Carry flag (1 or 0).
          * 
-         * @param opReg Pointer to the register that will be used as the operand.
-         * @param GetValue Pointer to the operand register's member function that will take the
+         * @tparam opReg Pointer to the register that will be used as the operand.
+         * @tparam GetValue Pointer to the operand register's member function that will take the
          *                 High or Low part of the register.
          * 
          * @note Sets the Z flag according to the calculation.
@@ -409,7 +662,8 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t AddCarry_8bit(RegisterPointer opReg, RegisterGet8Bit GetValue);
+        template<RegisterPointer opReg, RegisterGet8Bit GetValue>
+        size_t AddCarry_8bit();
 
         /**
          * @brief Adds the value found at the current program counter (PC) to the accumulator register,
@@ -428,7 +682,7 @@ private:
          * @brief Adds the contents from memory location addrReg to the accumulator register, combined with the 
          *        contents of the Carry flag (1 or 0).
          * 
-         * @param addrReg Pointer to the register which contains the location of 
+         * @tparam addrReg Pointer to the register which contains the location of 
          *                the memory that will be used for the addition.
          * 
          * @note Sets the Z flag according to the calculation.
@@ -438,13 +692,14 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t AddCarry_8bit_Addr(RegisterPointer addrReg);
+        template<RegisterPointer addrReg>
+        size_t AddCarry_8bit_Addr();
 
         /**
          * @brief Subtracts the contents of opReg from the accumulator register.
          * 
-         * @param opReg Pointer to the register that will be used as the operand.
-         * @param GetValue Pointer to the operand register's member function that will take the
+         * @tparam opReg Pointer to the register that will be used as the operand.
+         * @tparam GetValue Pointer to the operand register's member function that will take the
          *                 High or Low part of the register.
          * 
          * @note Sets the Z flag according to the calculation.
@@ -454,7 +709,8 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t Sub_8bit(RegisterPointer opReg, RegisterGet8Bit GetValue);
+        template<RegisterPointer opReg, RegisterGet8Bit GetValue>
+        size_t Sub_8bit();
 
         /**
          * @brief Subtracts the contents found on the address contained inside the program counter (PC)
@@ -473,7 +729,7 @@ private:
          * @brief Subtracts the contents of memory location addrReg
          *        from the accumulator register.
          * 
-         * @param addrReg Pointer to the register which contains the location of 
+         * @tparam addrReg Pointer to the register which contains the location of 
          *                the memory that will be used for the subtraction.
          * 
          * @note Sets the Z flag according to the calculation.
@@ -483,14 +739,15 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t Sub_8bit_Addr(RegisterPointer addrReg);
+        template<RegisterPointer addrReg>
+        size_t Sub_8bit_Addr();
 
         /**
          * @brief Subtracts the contents of fromReg combined with the contents of
          *        the Carry flag (1 or 0) from the accumulator register.
          * 
-         * @param opReg Pointer to the register that will be used as the operand.
-         * @param GetValue Pointer to the operand register's member function that will take the
+         * @tparam opReg Pointer to the register that will be used as the operand.
+         * @tparam GetValue Pointer to the operand register's member function that will take the
          *                 High or Low part of the register.
          * 
          * @note Sets the Z flag according to the calculation.
@@ -500,7 +757,8 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t SubCarry_8bit(RegisterPointer opReg, RegisterGet8Bit GetValue);
+        template<RegisterPointer opReg, RegisterGet8Bit GetValue>
+        size_t SubCarry_8bit();
 
         /**
          * @brief Subtracts the contents found at the addres inside the program counter (PC)
@@ -519,7 +777,7 @@ private:
          * @brief Subtracts the contents of memory location addrReg combined
          *        with the contents of the Carry flag (1 or 0) from the accumulator register.
          * 
-         * @param addrReg Pointer to the register which contains the location of 
+         * @tparam addrReg Pointer to the register which contains the location of 
          *                the memory that will be used for the subtraction.
          * 
          * @note Sets the Z flag according to the calculation.
@@ -529,15 +787,16 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t SubCarry_8bit_Addr(RegisterPointer addrReg);
+        template<RegisterPointer addrReg>
+        size_t SubCarry_8bit_Addr();
 
         /**
          * @brief Increments the data inside the provided register by 1.
          * 
-         * @param opReg Pointer to the register that will be used as the operand.
-         * @param GetValue Pointer to the operand register's member function that will take the
+         * @tparam opReg Pointer to the register that will be used as the operand.
+         * @tparam GetValue Pointer to the operand register's member function that will take the
          *                 High or Low part of the register.
-         * @param SetValue Pointer to the register where the resulting value will be set.
+         * @tparam SetValue Pointer to the register where the resulting value will be set.
          * 
          * @note The Z flag is set if the incrementation results in a 0.
          * @note The S flag is set to false.
@@ -545,27 +804,29 @@ private:
          * 
          * @return number of cycles. 
          */
-        size_t Increment_8bit(RegisterPointer opReg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue);
+        template<RegisterPointer opReg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+        size_t Increment_8bit();
 
         /**
          * @brief Increments the value pointed to by addrReg by one.
          * 
-         * @param addrReg Pointer the the register containing the address of the value
+         * @tparam addrReg Pointer the the register containing the address of the value
          *                that needs to be incremented.
          * 
          * @note The Z flag is set if the increment results in a 0.
          * @note the S flag is set to false.
          * @note the H flag is set according to the calculation.
          */
-        size_t Increment_Dereferenced(RegisterPointer addrReg);
+        template<RegisterPointer addrReg>
+        size_t Increment_Dereferenced();
 
         /**
          * @brief Decrements the data inside the provided register by 1.
          * 
-         * @param opReg Pointer to the register that will be used as the operand.
-         * @param GetValue Pointer to the operand register's member function that will take the
+         * @tparam opReg Pointer to the register that will be used as the operand.
+         * @tparam GetValue Pointer to the operand register's member function that will take the
          *                 High or Low part of the register.
-         * @param SetValue Pointer to the register where the resulting value will be set.
+         * @tparam SetValue Pointer to the register where the resulting value will be set.
          * 
          * @note The Z flag is set if the decrementation results in a 0.
          * @note The S flag is set to true.
@@ -573,19 +834,21 @@ private:
          * 
          * @return number of cycles. 
          */
-        size_t Decrement_8bit(RegisterPointer opReg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue);
+        template<RegisterPointer opReg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+        size_t Decrement_8bit();
 
         /**
          * @brief Decrements the value pointed to by addrReg by one.
          * 
-         * @param addrReg Pointer to the register containing the address of the value
+         * @tparam addrReg Pointer to the register containing the address of the value
          *                that needs to be decremented.
          * 
          * @note The Z flag is set if the decrement results in a 0.
          * @note The S flag is set to true.
          * @note The H flag is set according to the calculation.
          */
-        size_t Decrement_Dereferenced(RegisterPointer addrReg);
+        template<RegisterPointer addrReg>
+        size_t Decrement_Dereferenced();
 
         /**
          * @brief Performs a bitwise AND on the accumulator register with the
@@ -601,7 +864,8 @@ private:
          * @note The H flag is set to true.
          * @note The C flag is set to false.
          */
-        size_t BitwiseAnd(RegisterPointer reg, RegisterGet8Bit GetOperand);
+        template<RegisterPointer reg, RegisterGet8Bit GetOperand>
+        size_t BitwiseAnd();
 
         /**
          * @brief Performs a bitwise AND on the accumulator register with the
@@ -615,7 +879,8 @@ private:
          * @note The H flag is set to true.
          * @note The C flag is set to false.
          */
-        size_t BitwiseAnd_Addr(RegisterPointer addrReg);
+        template<RegisterPointer addrReg>
+        size_t BitwiseAnd_Addr();
 
         /**
          * @brief Performs a bitwise AND on the accumulator register with the
@@ -642,7 +907,8 @@ private:
          * @note The H flag is set to true.
          * @note The C flag is set to false.
          */
-        size_t BitwiseXor(RegisterPointer reg, RegisterGet8Bit GetOperand);
+        template<RegisterPointer reg, RegisterGet8Bit GetOperand>
+        size_t BitwiseXor();
 
         /**
          * @brief Performs a bitwise XOR on the accumulator register with the
@@ -656,7 +922,8 @@ private:
          * @note The H flag is set to true.
          * @note The C flag is set to false.
          */
-        size_t BitwiseXor_Addr(RegisterPointer addrReg);
+        template<RegisterPointer addrReg>
+        size_t BitwiseXor_Addr();
 
         /**
          * @brief Performs a bitwise XOR on the accumulator register with the
@@ -683,7 +950,8 @@ private:
          * @note The H flag is set to true.
          * @note The C flag is set to false.
          */
-        size_t BitwiseOr(RegisterPointer reg, RegisterGet8Bit GetOperand);
+        template<RegisterPointer reg, RegisterGet8Bit GetOperand>
+        size_t BitwiseOr();
 
         /**
          * @brief Performs a bitwise OR on the accumulator register with the
@@ -697,7 +965,8 @@ private:
          * @note The H flag is set to false.
          * @note The C flag is set to false.
          */
-        size_t BitwiseOr_Addr(RegisterPointer addrReg);
+        template<RegisterPointer addrReg>
+        size_t BitwiseOr_Addr();
 
         /**
          * @brief Performs a bitwise OR on the accumulator register with the
@@ -716,25 +985,27 @@ private:
          * 
          * @note The 8 bits of immediate data are added to the value of 0xFF'00 to get the final address.
          * 
-         * @param dataReg Pointer to the register where the data will be taken from.
+         * @tparam dataReg Pointer to the register where the data will be taken from.
          * @param GetValue Pointer to the dataReg register's member function that will take the
          *                 High or Low part of the register.
          * 
          * @return number of cycles.
          */
-        size_t Store_8bit_8bitImmediateAddr(RegisterPointer dataReg, RegisterGet8Bit GetData);
+        template<RegisterPointer dataReg, RegisterGet8Bit GetData>
+        size_t Store_8bit_8bitImmediateAddr();
 
         /**
          * @brief Stores the byte found in the register of dataReg to the memory location pointed to by the
          *        immediate address found inside the location pointed to by the program counter (PC).
          *  
-         * @param dataReg Pointer to the register where the data will be taken from.
+         * @tparam dataReg Pointer to the register where the data will be taken from.
          * @param GetValue Pointer to the dataReg register's member function that will take the
          *                 High or Low part of the register.
          * 
          * @return number of cycles.
          */
-        size_t Store_8bit_16bitImmediateAddr(RegisterPointer dataReg, RegisterGet8Bit GetData);
+        template<RegisterPointer dataReg, RegisterGet8Bit GetData>
+        size_t Store_8bit_16bitImmediateAddr();
 
         /**
          * @brief Stores the byte found in the register of dataReg to the memory location
@@ -742,68 +1013,73 @@ private:
          * 
          * @note The 8 bits address found inside addrReg is added to the value of 0xFF'00 to get the final address.
          * 
-         * @param addrReg Pointer to the register containing the address where the data needs to be stored. 
-         * @param dataReg Pointer to the register where the data will be taken from.
+         * @tparam addrReg Pointer to the register containing the address where the data needs to be stored. 
+         * @tparam dataReg Pointer to the register where the data will be taken from.
          * @param GetValue Pointer to the dataReg register's member function that will take the
          *                 High or Low part of the register.
          * 
          * @return number of cycles.
          */
-        size_t Store_8bit_8bitAddr(RegisterPointer addrReg, RegisterGet8Bit GetAddr, RegisterPointer dataReg, RegisterGet8Bit GetData);
+        template<RegisterPointer addrReg, RegisterGet8Bit GetAddr, RegisterPointer dataReg, RegisterGet8Bit GetData>
+        size_t Store_8bit_8bitAddr();
 
         /**
          * @brief Stores the byte found in the register of dataReg to the addres Pointed to by addrReg.
          * 
-         * @param addrReg Pointer to the register containing the address where the data needs to be stored. 
-         * @param dataReg Pointer to the register where the data will be taken from.
+         * @tparam addrReg Pointer to the register containing the address where the data needs to be stored. 
+         * @tparam dataReg Pointer to the register where the data will be taken from.
          * @param GetValue Pointer to the dataReg register's member function that will take the
          *                 High or Low part of the register.
          * 
          * @return number of cycles.
          */
-        size_t Store_8bit_Addr(RegisterPointer addrReg, RegisterPointer dataReg, RegisterGet8Bit GetData);
+        template<RegisterPointer addrReg, RegisterPointer dataReg, RegisterGet8Bit GetData>
+        size_t Store_8bit_Addr();
 
         /**
          * @brief Stores the byte found in the high register of dataReg to the addres
          *        pointed to by addrReg after which the contents of addrReg gets incremented by 1.
          * 
-         * @param addrReg Pointer to the register containing the address where the data needs to be stored. 
-         * @param dataReg Pointer to the register where the data will be taken from.
+         * @tparam addrReg Pointer to the register containing the address where the data needs to be stored. 
+         * @tparam dataReg Pointer to the register where the data will be taken from.
          * @param GetValue Pointer to the dataReg register's member function that will take the
          *                 High or Low part of the register.
          * 
          * @return number of cycles.
          */
-        size_t Store_8bit_AddrIncrement(RegisterPointer addrReg, RegisterPointer dataReg, RegisterGet8Bit GetData);
+        template<RegisterPointer addrReg, RegisterPointer dataReg, RegisterGet8Bit GetData>
+        size_t Store_8bit_AddrIncrement();
 
         /**
          * @brief Stores the byte found in the high register of dataReg to the addres
          *        pointed to by addrReg after which the contents of addrReg gets decremented by 1.
          * 
-         * @param addrReg Pointer to the register containing the address where the data needs to be stored. 
-         * @param dataReg Pointer to the register where the data will be taken from.
+         * @tparam addrReg Pointer to the register containing the address where the data needs to be stored. 
+         * @tparam dataReg Pointer to the register where the data will be taken from.
          * @param GetValue Pointer to the dataReg register's member function that will take the
          *                 High or Low part of the register.
          * 
          * @return number of cycles.
          */
-        size_t Store_8bit_AddrDecrement(RegisterPointer addrReg, RegisterPointer dataReg, RegisterGet8Bit GetData);
+        template<RegisterPointer addrReg, RegisterPointer dataReg, RegisterGet8Bit GetData>
+        size_t Store_8bit_AddrDecrement();
 
         /**
          * @brief Stores the byte found at the current PC register location to the destination
          *        pointed to by addrReg.
          * 
-         * @param addrReg pointer to the register containing the address where the data needs to be stored.
+         * @tparam addrReg pointer to the register containing the address where the data needs to be stored.
          * 
          * @return number of cycles.
          */
-        size_t Store_8bit_Addr_ImmediateData(RegisterPointer addrReg);
+        template<RegisterPointer addrReg>
+        size_t Store_8bit_Addr_ImmediateData();
 
 
         /**
          * @brief Adds the signed 8 bits of immediate data to the StackPointer and stores the result inside reg.
          * 
-         * @param reg Pointer to the register where the data will to be stored.
+         * @tparam reg Pointer to the register where the data will to be stored.
          * 
          * @note The Z flag is set to false.
          * @note The S flag is set to false.
@@ -812,18 +1088,20 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t Store_StackPointerPlusSignedImmediateData(RegisterPointer reg);
+        template<RegisterPointer reg>
+        size_t Store_StackPointerPlusSignedImmediateData();
 
         /**
          * @brief Loads the 8bit immediate data into the provided register.
          * 
-         * @param reg Pointer to the register where the data will be loaded into.
-         * @param SetValue Pointer to the register's member function that will store the result inside
+         * @tparam reg Pointer to the register where the data will be loaded into.
+         * @tparam SetValue Pointer to the register's member function that will store the result inside
          *                 High or Low part of the register.
          * 
          * @return number of cycles. 
          */
-        size_t Load_8bit_ImmediateData(RegisterPointer reg, RegisterSet8Bit SetValue);
+        template<RegisterPointer reg, RegisterSet8Bit SetValue>
+        size_t Load_8bit_ImmediateData();
 
         /**
          * @brief Loads the 8 bits of memory found at the location pointed to
@@ -831,7 +1109,8 @@ private:
          * 
          * @return number of cycles. 
          */
-        size_t Load_8bit_ImmediateAddr(RegisterPointer reg, RegisterSet8Bit SetValue);
+        template<RegisterPointer reg, RegisterSet8Bit SetValue>
+        size_t Load_8bit_ImmediateAddr();
 
         /**
          * @brief Loads the 8 bits of memory found at the 8bit immediate data into the provided register.
@@ -841,77 +1120,83 @@ private:
          * 
          * @return number of cycles. 
          */
-        size_t Load_8bit_8bitImmediateAddr(RegisterPointer reg, RegisterSet8Bit SetValue);
+        template<RegisterPointer reg, RegisterSet8Bit SetValue>
+        size_t Load_8bit_8bitImmediateAddr();
 
         /**
          * @brief Loads the 8bits of data found at the addrReg into destReg.
          * 
-         * @param destReg  Pointer to the register where the data is loaded into.
-         * @param SetValue Member function pointer of destReg, specifying the high or low part of the register. 
-         * @param addrReg  Pointer to the register containing the address where the data is located.
+         * @tparam destReg  Pointer to the register where the data is loaded into.
+         * @tparam SetValue Member function pointer of destReg, specifying the high or low part of the register. 
+         * @tparam addrReg  Pointer to the register containing the address where the data is located.
          * 
          * @return number of cycles. 
          */
-        size_t Load_8bit_Addr(RegisterPointer destReg, RegisterSet8Bit SetValue, RegisterPointer addrReg);
+        template<RegisterPointer destReg, RegisterSet8Bit SetValue, RegisterPointer addrReg>
+        size_t Load_8bit_Addr();
 
         /**
          * @brief Loads the 8bits of data from the 8bit address found inside addrReg and loads it into destReg.
          * 
          * @note The bit bit address will be added to the value 0xFF00, making an effective address of 0xFF00-0xFFFF.
          * 
-         * @param destReg  Pointer to the register where the data is loaded into.
-         * @param SetValue Member function pointer of destReg, specifying the high or low part of the register. 
-         * @param addrReg  Pointer to the register containing the 8bit address where the data is located.
-         * @param GetAddr  Member function pointer of addrReg, specifying the high or low part of the register.
+         * @tparam destReg  Pointer to the register where the data is loaded into.
+         * @tparam SetValue Member function pointer of destReg, specifying the high or low part of the register. 
+         * @tparam addrReg  Pointer to the register containing the 8bit address where the data is located.
+         * @tparam GetAddr  Member function pointer of addrReg, specifying the high or low part of the register.
          * 
          * @return number of cycles. 
          */
-        size_t Load_8bit_8bitAddr(RegisterPointer destReg, RegisterSet8Bit SetValue, RegisterPointer addrReg, RegisterGet8Bit GetAddr);
+        template<RegisterPointer destReg, RegisterSet8Bit SetValue, RegisterPointer addrReg, RegisterGet8Bit GetAddr>
+        size_t Load_8bit_8bitAddr();
 
         /**
          * @brief Loads the 8 bits of data found at addrReg into destReg, after which the pointer inside
          *        addrReg gets incremented by 1.
          * 
-         * @param destReg  Pointer to the register where the data is loaded into.
-         * @param SetValue Member function pointer of destReg, specifying the high or low part of the register. 
-         * @param addrReg  Pointer to the register containing the address where the data is located.
+         * @tparam destReg  Pointer to the register where the data is loaded into.
+         * @tparam SetValue Member function pointer of destReg, specifying the high or low part of the register. 
+         * @tparam addrReg  Pointer to the register containing the address where the data is located.
          *                 Will get incremented by 1 after the data is retrieved.
          * 
          * @return number of cycles.
          */
-        size_t Load_8bit_AddrIncrement(RegisterPointer destReg, RegisterSet8Bit SetValue, RegisterPointer addrReg);
+        template<RegisterPointer destReg, RegisterSet8Bit SetValue, RegisterPointer addrReg>
+        size_t Load_8bit_AddrIncrement();
 
         /**
          * @brief Loads the 8 bits of data found at addrReg into destReg, after which the pointer inside
          *        addrReg gets decremented by 1.
          * 
-         * @param destReg  Pointer to the register where the data is loaded into.
-         * @param SetValue Member function pointer of destReg, specifying the high or low part of the register. 
-         * @param addrReg  Pointer to the register containing the address where the data is located.
+         * @tparam destReg  Pointer to the register where the data is loaded into.
+         * @tparam SetValue Member function pointer of destReg, specifying the high or low part of the register. 
+         * @tparam addrReg  Pointer to the register containing the address where the data is located.
          *                 Will get decremented by 1 after the data is retrieved.
          * 
          * @return number of cycles.
          */
-        size_t Load_8bit_AddrDecrement(RegisterPointer destReg, RegisterSet8Bit SetValue, RegisterPointer addrReg);
+        template<RegisterPointer destReg, RegisterSet8Bit SetValue, RegisterPointer addrReg>
+        size_t Load_8bit_AddrDecrement();
 
         /**
          * @brief Loads the contents 8 bit of fromReg into toReg.
          * 
-         * @param destReg  Pointer to the register where the data is loaded into.
-         * @param SetValue Member function pointer of destReg, specifying the high or low part of the register. 
-         * @param fromReg  Pointer to the register where the data is taken from.
-         * @param GetValue Member function pointer of fromReg, specifying the high or low part of the register.
+         * @tparam destReg  Pointer to the register where the data is loaded into.
+         * @tparam SetValue Member function pointer of destReg, specifying the high or low part of the register. 
+         * @tparam fromReg  Pointer to the register where the data is taken from.
+         * @tparam GetValue Member function pointer of fromReg, specifying the high or low part of the register.
          * 
          * @return number of cycles.
          */
-        size_t Load_8bit(RegisterPointer destReg, RegisterSet8Bit SetValue, RegisterPointer fromReg, RegisterGet8Bit GetValue);
+        template<RegisterPointer destReg, RegisterSet8Bit SetValue, RegisterPointer fromReg, RegisterGet8Bit GetValue>
+        size_t Load_8bit();
 
         /**
          * @brief Compares the 8 bit value of opReg to the accumulator register
          *        by calculating (A - operand).
          * 
-         * @param opReg    Pointer to the register that will be used as the operand.
-         * @param GetValue Pointer to the operand register's member function that will take the
+         * @tparam opReg    Pointer to the register that will be used as the operand.
+         * @tparam GetValue Pointer to the operand register's member function that will take the
          *                 High or Low part of the register.
          * 
          * @note The Z flag is set if they are equal.
@@ -921,13 +1206,14 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t Compare_8bit(RegisterPointer opReg, RegisterGet8Bit GetValue);
+        template<RegisterPointer opReg, RegisterGet8Bit GetValue>
+        size_t Compare_8bit();
 
         /**
          * @brief Compares the 8 bit value found at addrReg to the accumulator register
          *        by calculating (A - operand).
          * 
-         * @param addrReg Pointer to the register containing the address of the operand used
+         * @tparam addrReg Pointer to the register containing the address of the operand used
          *                within the comparison.
          * 
          * @note The Z flag is set if they are equal.
@@ -937,7 +1223,8 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t Compare_8bit_Addr(RegisterPointer addrReg);
+        template<RegisterPointer addrReg>
+        size_t Compare_8bit_Addr();
 
         /**
          * @brief Compares the 8 bit immediate data to the accumulator register by calculating (A - operand).
@@ -959,10 +1246,10 @@ private:
          *        appending the state of the carry flag bit to the right of the same register.
          *        The shifted-out bit will become the new state of the carry flag.
          * 
-         * @param reg      Pointer to the register that will be used as the operand.
-         * @param GetValue Pointer to the register's member function that will take the
+         * @tparam reg      Pointer to the register that will be used as the operand.
+         * @tparam GetValue Pointer to the register's member function that will take the
          *                 High or Low part of the register.
-         * @param SetValue Pointer to the register's member function that will store the result
+         * @tparam SetValue Pointer to the register's member function that will store the result
          *                 into the High or Low part of the register.
          * 
          * @note The Z flag is set to false.
@@ -972,7 +1259,8 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t NoPrefixRotateLeft(RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue);
+        template<RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+        size_t NoPrefixRotateLeft();
 
         /**
          * @note Non prefixed version of the rotate instruction, difference being the 
@@ -982,10 +1270,10 @@ private:
          *        appending the shifted-out bit to the right of that same register
          *        and storing that same bit into the carry register.
          * 
-         * @param reg      Pointer to the register that will be used as the operand.
-         * @param GetValue Pointer to the register's member function that will take the
+         * @tparam reg      Pointer to the register that will be used as the operand.
+         * @tparam GetValue Pointer to the register's member function that will take the
          *                 High or Low part of the register.
-         * @param SetValue Pointer to the register's member function that will store the result
+         * @tparam SetValue Pointer to the register's member function that will store the result
          *                 into the High or Low part of the register.
          * 
          * @note The Z flag is set to false.
@@ -995,7 +1283,8 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t NoPrefixRotateLeftCarry(RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue);
+        template<RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+        size_t NoPrefixRotateLeftCarry();
 
         /**
          * @note Non prefixed version of the rotate instruction, difference being the 
@@ -1005,10 +1294,10 @@ private:
          *        appending the state of the carry flag bit to the left of the same register. 
          *        The shifted-out bit will become the new state of the carry flag.
          * 
-         * @param reg      Pointer to the register that will be used as the operand.
-         * @param GetValue Pointer to the register's member function that will take the
+         * @tparam reg      Pointer to the register that will be used as the operand.
+         * @tparam GetValue Pointer to the register's member function that will take the
          *                 High or Low part of the register.
-         * @param SetValue Pointer to the register's member function that will store the result
+         * @tparam SetValue Pointer to the register's member function that will store the result
          *                 into the High or Low part of the register.
          * 
          * @note The Z flag is set to false.
@@ -1018,7 +1307,8 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t NoPrefixRotateRight(RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue);
+        template<RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+        size_t NoPrefixRotateRight();
 
         /**
          * @note Non prefixed version of the rotate instruction, difference being the 
@@ -1028,10 +1318,10 @@ private:
          *        appending the shifted-out bit to the left of that same register
          *        and storing that same bit into the carry register.
          * 
-         * @param reg      Pointer to the register that will be used as the operand.
-         * @param GetValue Pointer to the register's member function that will take the
+         * @tparam reg      Pointer to the register that will be used as the operand.
+         * @tparam GetValue Pointer to the register's member function that will take the
          *                 High or Low part of the register.
-         * @param SetValue Pointer to the register's member function that will store the result
+         * @tparam SetValue Pointer to the register's member function that will store the result
          *                 into the High or Low part of the register.
          * 
          * @note The Z flag is set to false.
@@ -1041,7 +1331,8 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t NoPrefixRotateRightCarry(RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue);
+        template<RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+        size_t NoPrefixRotateRightCarry();
 
         /**                                     Prefixed Instructions                                     **/
     
@@ -1051,10 +1342,10 @@ private:
          *        appending the state of the carry flag bit to the right of the same register.
          *        The shifted-out bit will become the new state of the carry flag.
          * 
-         * @param reg      Pointer to the register that will be used as the operand.
-         * @param GetValue Pointer to the register's member function that will take the
+         * @tparam reg      Pointer to the register that will be used as the operand.
+         * @tparam GetValue Pointer to the register's member function that will take the
          *                 High or Low part of the register.
-         * @param SetValue Pointer to the register's member function that will store the result
+         * @tparam SetValue Pointer to the register's member function that will store the result
          *                 into the High or Low part of the register.
          * 
          * @note The Z flag is set according to the result.
@@ -1064,14 +1355,15 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t RotateLeft(RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue);
+        template<RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+        size_t RotateLeft();
 
         /**
          * @brief Rotates the value pointed to by addrReg to the left by 1 through the carry flag, that is,
          *        appending the state of the carry flag bit to the right of the same register.
          *        The shifted-out bit will become the new state of the carry flag.
          * 
-         * @param addrReg Pointer to the register containing the address of the value
+         * @tparam addrReg Pointer to the register containing the address of the value
          *                that will be used as the operand.
          * 
          * @note The Z flag is set according to the result.
@@ -1081,17 +1373,18 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t RotateLeft_Addr(RegisterPointer addrReg);
+        template<RegisterPointer addrReg>
+        size_t RotateLeft_Addr();
 
         /**
          * @brief Rotates the given register to the left by 1,
          *        appending the shifted-out bit to the right of that same register
          *        and storing that same bit into the carry register.
          * 
-         * @param reg      Pointer to the register that will be used as the operand.
-         * @param GetValue Pointer to the register's member function that will take the
+         * @tparam reg      Pointer to the register that will be used as the operand.
+         * @tparam GetValue Pointer to the register's member function that will take the
          *                 High or Low part of the register.
-         * @param SetValue Pointer to the register's member function that will store the result
+         * @tparam SetValue Pointer to the register's member function that will store the result
          *                 into the High or Low part of the register.
          * 
          * @note The Z flag is set to according to the result.
@@ -1101,14 +1394,15 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t RotateLeftCarry(RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue);
+        template<RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+        size_t RotateLeftCarry();
 
         /**
          * @brief Rotates the value pointed to by addrReg to the left by 1,
          *        appending the shifted-out bit to the right of that same value
          *        and storing that same bit into the carry register.
          * 
-         * @param addrReg Pointer to the register containing the address of the value
+         * @tparam addrReg Pointer to the register containing the address of the value
          *                that will be used as the operand.
          * 
          * @note The Z flag is set to according to the result.
@@ -1118,17 +1412,18 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t RotateLeftCarry_Addr(RegisterPointer addrReg);
+        template<RegisterPointer addrReg>
+        size_t RotateLeftCarry_Addr();
 
         /**
          * @brief Rotates the given register to the right by 1 through the carry flag, that is,
          *        appending the state of the carry flag bit to the left of the same register. 
          *        The shifted-out bit will become the new state of the carry flag.
          * 
-         * @param reg      Pointer to the register that will be used as the operand.
-         * @param GetValue Pointer to the register's member function that will take the
+         * @tparam reg      Pointer to the register that will be used as the operand.
+         * @tparam GetValue Pointer to the register's member function that will take the
          *                 High or Low part of the register.
-         * @param SetValue Pointer to the register's member function that will store the result
+         * @tparam SetValue Pointer to the register's member function that will store the result
          *                 into the High or Low part of the register.
          * 
          * @note The Z flag is set to according to the result.
@@ -1138,14 +1433,15 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t RotateRight(RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue);
+        template<RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+        size_t RotateRight();
 
         /**
          * @brief Rotates the value pointed to by addrReg to the right by 1 through the carry flag, that is,
          *        appending the state of the carry flag bit to the left of the same value. 
          *        The shifted-out bit will become the new state of the carry flag.
          * 
-         * @param addrReg Pointer to the register containing the address of the value
+         * @tparam addrReg Pointer to the register containing the address of the value
          *                that will be used as the operand.
          * 
          * @note The Z flag is set to according to the result.
@@ -1155,17 +1451,18 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t RotateRight_Addr(RegisterPointer addrReg);
+        template<RegisterPointer addrReg>
+        size_t RotateRight_Addr();
 
         /**
          * @brief Rotates the given register to the right by 1,
          *        appending the shifted-out bit to the left of that same register
          *        and storing that same bit into the carry register.
          * 
-         * @param reg      Pointer to the register that will be used as the operand.
-         * @param GetValue Pointer to the register's member function that will take the
+         * @tparam reg      Pointer to the register that will be used as the operand.
+         * @tparam GetValue Pointer to the register's member function that will take the
          *                 High or Low part of the register.
-         * @param SetValue Pointer to the register's member function that will store the result
+         * @tparam SetValue Pointer to the register's member function that will store the result
          *                 into the High or Low part of the register.
          * 
          * @note The Z flag is set to according to the result.
@@ -1175,14 +1472,15 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t RotateRightCarry(RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue);
+        template<RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+        size_t RotateRightCarry();
 
         /**
          * @brief Rotates the value pointed to by addrReg to the right by 1,
          *        appending the shifted-out bit to the left side of that same value
          *        and storing that same bit into the carry register.
          * 
-         * @param addrReg Pointer to the register containing the address of the value
+         * @tparam addrReg Pointer to the register containing the address of the value
          *                that will be used as the operand.
          * 
          * @note The Z flag is set to according to the result.
@@ -1192,16 +1490,17 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t RotateRightCarry_Addr(RegisterPointer addrReg);
+        template<RegisterPointer addrReg>
+        size_t RotateRightCarry_Addr();
 
         /**
          * @brief Shifts the given register to the left by 1. The Bit being shifted out is copied to the
          *        Carry flag whist the first bit (bit 0) will be reset to 0.
          * 
-         * @param reg      Pointer to the register that will be used as the operand.
-         * @param GetValue Pointer to the register's member function that will take the
+         * @tparam reg      Pointer to the register that will be used as the operand.
+         * @tparam GetValue Pointer to the register's member function that will take the
          *                 High or Low part of the register.
-         * @param SetValue Pointer to the register's member function that will store the result
+         * @tparam SetValue Pointer to the register's member function that will store the result
          *                 into the High or Low part of the register.
          * 
          * @note The Z flag is set to according to the result.
@@ -1211,14 +1510,15 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t ShiftLeftArithmetic(RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue);
+        template<RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+        size_t ShiftLeftArithmetic();
 
         /**
          * @brief Shifts the value pointed to by addrReg to the left by 1.
          *        The Bit being shifted out is copied to the Carry flag
          *        whist the first bit (bit 0) will be reset to 0.
          * 
-         * @param addrReg Pointer to the register containing the address of the value
+         * @tparam addrReg Pointer to the register containing the address of the value
          *                that will be used as the operand.
          * 
          * @note The Z flag is set to according to the result.
@@ -1228,16 +1528,17 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t ShiftLeftArithmetic_Addr(RegisterPointer addrReg);
+        template<RegisterPointer addrReg>
+        size_t ShiftLeftArithmetic_Addr();
 
         /**
          * @brief Shifts the given register to the right by 1. The Bit being shifted out is copied to the
          *        Carry flag whist the last bit (bit 7) will remain unchanged compared to the initial value.
          * 
-         * @param reg      Pointer to the register that will be used as the operand.
-         * @param GetValue Pointer to the register's member function that will take the
+         * @tparam reg      Pointer to the register that will be used as the operand.
+         * @tparam GetValue Pointer to the register's member function that will take the
          *                 High or Low part of the register.
-         * @param SetValue Pointer to the register's member function that will store the result
+         * @tparam SetValue Pointer to the register's member function that will store the result
          *                 into the High or Low part of the register.
          * 
          * @note The Z flag is set to according to the result.
@@ -1247,14 +1548,15 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t ShiftRightArithmetic(RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue);
+        template<RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+        size_t ShiftRightArithmetic();
 
         /**
          * @brief Shifts the value pointed to by addrReg to the right by 1.
          *        The Bit being shifted out is copied to the Carry flag
          *        whist the last bit (bit 7) will remain unchanged compared to the initial value.
          * 
-         * @param addrReg Pointer to the register containing the address of the value
+         * @tparam addrReg Pointer to the register containing the address of the value
          *                that will be used as the operand.
          * 
          * @note The Z flag is set to according to the result.
@@ -1264,16 +1566,17 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t ShiftRightArithmetic_Addr(RegisterPointer addrReg);
+        template<RegisterPointer addrReg>
+        size_t ShiftRightArithmetic_Addr();
 
         /**
          * @brief Shifts the given register to the right by 1. The Bit being shifted out is copied to the
          *        Carry flag whist the last bit (bit 7) will be reset to 0.
          * 
-         * @param reg      Pointer to the register that will be used as the operand.
-         * @param GetValue Pointer to the register's member function that will take the
+         * @tparam reg      Pointer to the register that will be used as the operand.
+         * @tparam GetValue Pointer to the register's member function that will take the
          *                 High or Low part of the register.
-         * @param SetValue Pointer to the register's member function that will store the result
+         * @tparam SetValue Pointer to the register's member function that will store the result
          *                 into the High or Low part of the register.
          * 
          * @note The Z flag is set to according to the result.
@@ -1283,14 +1586,15 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t ShiftRightLogical(RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue);
+        template<RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+        size_t ShiftRightLogical();
 
         /**
          * @brief Shifts the value pointed to by addrReg to the right by 1.
          *        The Bit being shifted out is copied to the Carry flag
          *        whist the last bit (bit 7) will be reset to 0.
          * 
-         * @param addrReg Pointer to the register containing the address of the value
+         * @tparam addrReg Pointer to the register containing the address of the value
          *                that will be used as the operand.
          * 
          * @note The Z flag is set to according to the result.
@@ -1300,15 +1604,16 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t ShiftRightLogical_Addr(RegisterPointer addrReg);
+        template<RegisterPointer addrReg>
+        size_t ShiftRightLogical_Addr();
 
         /**
          * @brief Swaps the lower-order (0-3) with the higher-order bits (4-7).
          * 
-         * @param reg      Pointer to the register that will be used as the operand.
-         * @param GetValue Pointer to the register's member function that will take the
+         * @tparam reg      Pointer to the register that will be used as the operand.
+         * @tparam GetValue Pointer to the register's member function that will take the
          *                 High or Low part of the register.
-         * @param SetValue Pointer to the register's member function that will store the result
+         * @tparam SetValue Pointer to the register's member function that will store the result
          *                 into the High or Low part of the register.
          * 
          * @note The Z flag is set to according to the result.
@@ -1318,13 +1623,14 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t Swap(RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue);
+        template<RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+        size_t Swap();
 
         /**
          * @brief Swaps the lower-order (0-3) with the higher-order bits (4-7) of the value pointed to
          *        by addrReg.
          * 
-         * @param addrReg Pointer to the register containing the address of the value
+         * @tparam addrReg Pointer to the register containing the address of the value
          *                that will be used as the operand.
          * 
          * @note The Z flag is set to according to the result.
@@ -1334,14 +1640,15 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t Swap_Addr(RegisterPointer addrReg);
+        template<RegisterPointer addrReg>
+        size_t Swap_Addr();
 
         /**
          * @brief Takes the complement of a bit found inside reg and sets the zero flag to it.
          * 
-         * @param bitMask  A mask for the bit which the complement will be taken from.
-         * @param reg      Pointer to the register that will be used as the operand.
-         * @param GetValue Pointer to the register's member function that will take the
+         * @tparam bitMask  A mask for the bit which the complement will be taken from.
+         * @tparam reg      Pointer to the register that will be used as the operand.
+         * @tparam GetValue Pointer to the register's member function that will take the
          *                 High or Low part of the register.
          * 
          * @note The Z flag is set to the complement of the bit masked by the bitMask.
@@ -1350,13 +1657,14 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t BitComplementToZeroFlag(uint8_t bitMask, RegisterPointer reg, RegisterGet8Bit GetValue);
+        template<uint8_t bitMask, RegisterPointer reg, RegisterGet8Bit GetValue>
+        size_t BitComplementToZeroFlag();
 
         /**
          * @brief Takes the complement of a bit found inside reg and sets the zero flag to it.
          * 
-         * @param bitMask  A mask for the bit which the complement will be taken from.
-         * @param addrReg Pointer to the register containing the address of the value
+         * @tparam bitMask  A mask for the bit which the complement will be taken from.
+         * @tparam addrReg Pointer to the register containing the address of the value
          *                that will be used as the operand.
          * 
          * @note The Z flag is set to the complement of the bit masked by the bitMask.
@@ -1365,57 +1673,89 @@ private:
          * 
          * @return number of cycles.
          */
-        size_t BitComplementToZeroFlag_Addr(uint8_t bitMask, RegisterPointer addrReg);
+        template<uint8_t bitMask, RegisterPointer addrReg>
+        size_t BitComplementToZeroFlag_Addr();
 
         /**
          * @brief Resets a bit inside the given register to 0.
          * 
-         * @param bitMask  A mask for the bit which will be reset to 0.
-         * @param reg      Pointer to the register that will be used as the operand.
-         * @param GetValue Pointer to the register's member function that will take the
+         * @tparam bitMask  A mask for the bit which will be reset to 0.
+         * @tparam reg      Pointer to the register that will be used as the operand.
+         * @tparam GetValue Pointer to the register's member function that will take the
          *                 High or Low part of the register.
-         * @param SetValue Pointer to the register's member function that will store the result
+         * @tparam SetValue Pointer to the register's member function that will store the result
          *                 into the High or Low part of the register.
          * 
          * @return number of cycles.
          */
-        size_t BitReset(uint8_t bitMask, RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue);
+        template<uint8_t bitMask, RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+        size_t BitReset();
 
         /**
          * @brief Resets a bit inside the value pointed to by the address contained in the given register to 0.
          * 
-         * @param bitMask A mask for the bit which will be reset to 0.
-         * @param addrReg Pointer to the register containing the address of the value
+         * @tparam bitMask A mask for the bit which will be reset to 0.
+         * @tparam addrReg Pointer to the register containing the address of the value
          *                that will be used as the operand.
          * 
          * @return number of cycles.
          */
-        size_t BitReset_Addr(uint8_t bitMask, RegisterPointer addrReg);
+        template<uint8_t bitMask, RegisterPointer addrReg>
+        size_t BitReset_Addr();
 
         /**
          * @brief Sets a bit inside the given register to 1.
          * 
-         * @param bitMask  A mask for the bit which will be set to 1.
-         * @param reg      Pointer to the register that will be used as the operand.
-         * @param GetValue Pointer to the register's member function that will take the
+         * @tparam bitMask  A mask for the bit which will be set to 1.
+         * @tparam reg      Pointer to the register that will be used as the operand.
+         * @tparam GetValue Pointer to the register's member function that will take the
          *                 High or Low part of the register.
-         * @param SetValue Pointer to the register's member function that will store the result
+         * @tparam SetValue Pointer to the register's member function that will store the result
          *                 into the High or Low part of the register.
          * 
          * @return number of cycles.
          */
-        size_t BitSet(uint8_t bitMask, RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue);
+        template<uint8_t bitMask, RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+        size_t BitSet();
 
         /**
          * @brief Sets a bit inside the value pointed to by the address contained in the given register to 1.
          * 
-         * @param bitMask A mask for the bit which will be set to 1.
-         * @param addrReg Pointer to the register containing the address of the value
+         * @tparam bitMask A mask for the bit which will be set to 1.
+         * @tparam addrReg Pointer to the register containing the address of the value
          *                that will be used as the operand.
          * 
          * @return number of cycles.
          */
-        size_t BitSet_Addr(uint8_t bitMask, RegisterPointer addrReg);
+        template<uint8_t bitMask, RegisterPointer addrReg>
+        size_t BitSet_Addr();
     };
 
+	inline uint8_t Cpu::Fetch(uint16_t address)
+	{
+		return memoryBus.ReadByte(address);
+	}
+
+	inline uint8_t Cpu::FetchPcAddress()
+	{
+		const auto data = memoryBus.FetchByte(core.PC.Value());
+		core.PC++;
+		return data;
+	}
+
+	inline uint16_t Cpu::FetchPcAddress16bit()
+	{
+		const uint16_t address = core.PC.Value();
+		const auto data = (memoryBus.FetchByte(address) << 8) | memoryBus.FetchByte(address + 1);
+		core.PC += 2;
+		return data;
+	}
+
 }
+
+// Instruction handlers specialized per register, instantiated by the instruction tables.
+#include "instructions/BitOperations.ipp"
+#include "instructions/Bitwise.ipp"
+#include "instructions/LoadStoreMove.ipp"
+#include "instructions/Logical.ipp"
+#include "instructions/RotateShift.ipp"
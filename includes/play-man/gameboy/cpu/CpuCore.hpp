@@ -43,12 +43,52 @@ namespace GameBoy
 	CREATE_ENUM_WITH_UTILS(F_REGISTER_FLAGS_SEQ, FlagRegisterFlag)
 	#undef F_REGISTER_FLAGS_SEQ
 
+	/**
+	 * @brief The interrupt sources, as bits inside the IE and IF registers.
+	 */
+	#define INTERRUPT_SEQ(x, n)  \
+		x(n, VBlank, 0b00000001) \
+		x(n, Lcd,    0b00000010) \
+		x(n, Timer,  0b00000100) \
+		x(n, Serial, 0b00001000) \
+		x(n, Joypad, 0b00010000)
+
+	CREATE_ENUM_WITH_UTILS(INTERRUPT_SEQ, Interrupt)
+	#undef INTERRUPT_SEQ
+
+	/**
+	 * @brief The kind of the last flag affecting operation whose flags have not been computed yet.
+	 */
+	enum class LazyFlagOperation : uint8_t
+	{
+		None,      /* The flags inside the F register are up to date. */
+		Add,       /* ADD/ADC: result = base + operand + carryIn. */
+		Sub,       /* SUB/SBC/CP: result = base - operand - carryIn. */
+		Increment, /* INC: result = base + 1, carryIn holds the preserved carry flag. */
+		Decrement, /* DEC: result = base - 1, carryIn holds the preserved carry flag. */
+		And,       /* AND: half carry set, carry cleared. */
+		Or         /* OR/XOR: only the zero flag depends on the result. */
+	};
+
+	/**
+	 * @brief The operands of the last flag affecting operation, from which the flags get computed on demand.
+	 */
+	struct LazyFlags
+	{
+		LazyFlagOperation	operation = LazyFlagOperation::None;
+		uint8_t				base = 0;
+		uint8_t				operand = 0;
+		uint8_t				result = 0;
+		uint8_t				carryIn = 0;
+	};
+
 	constexpr uint16_t programCounterAfterBootRom = 0x0100;
     constexpr uint16_t stackPointerAfterStartup = 0xFFFE; // HRAM end address
 
     class CpuCore
     {
         friend class Cpu;
+        friend class Jit;
 		friend struct TestFixtures::GameBoyCpuFixture;
 
         // TODO: Set default values on construction
@@ -59,6 +99,7 @@ namespace GameBoy
         Register	SP = stackPointerAfterStartup; /* Stack pointer */
         Register	PC = programCounterAfterBootRom; /* Program counter */
         uint8_t		IE; /* Interrupt Enable Register*/
+        uint8_t		IF = 0; /* Interrupt Flag Register, the requested interrupts */
 
         /**
          * @brief Whether the emulator is set to DMG or CGB mode.
@@ -67,6 +108,11 @@ namespace GameBoy
          */
         bool        cgbMode = false;
 
+        /**
+         * @brief The last ALU operation, of which the flags have not been written to the F register yet.
+         */
+        LazyFlags   lazyFlags;
+
         // uint16_t	cyclesPassed = 0; /* */
 
         /**
@@ -85,19 +131,97 @@ namespace GameBoy
          */
         void    SetInterruptRegister(const uint8_t value);
 
+        /**
+         * @brief Returns the interrupt flag register (IF), the interrupts that have been requested.
+         */
+        uint8_t GetInterruptFlags() const
+        {
+            return IF;
+        }
+
+        /**
+         * @brief -.
+         */
+        void    SetInterruptFlags(const uint8_t value)
+        {
+            IF = value;
+        }
+
+        /**
+         * @brief Sets the interrupt's bit inside the interrupt flag register.
+         */
+        void    RequestInterrupt(Interrupt interrupt)
+        {
+            IF |= static_cast<uint8_t>(interrupt);
+        }
+
+        /**
+         * @brief Whether an enabled interrupt has been requested, which wakes up a halted cpu.
+         */
+        bool    InterruptPending() const
+        {
+            return (IE & IF & 0b0001'1111) != 0;
+        }
+
         /**
          * @brief Used to set a bit inside the flag register
          * @param flag The flag to be changed
          * @param enable Enable or disable the targeted flag
          */
-        void SetFlag(FlagRegisterFlag flag, bool enable);
+        void SetFlag(FlagRegisterFlag flag, bool enable)
+        {
+            MaterializeFlags();
+            if (enable)
+            {
+                AF.SetLowByte(AF.LowByte() | static_cast<uint8_t>(flag));
+            }
+            else
+            {
+                AF.SetLowByte(AF.LowByte() & ~(static_cast<uint8_t>(flag)));
+            }
+        }
 
         /**
          * @brief Used to retrieve the status of a flag inside teh flag register.
          * @param flag The flag to be returned.
          * @return true/false depending if the flag is set or not.
          */
-        bool GetFlag(FlagRegisterFlag flag);
+        bool GetFlag(FlagRegisterFlag flag) const
+        {
+            return (ComputeFlags() & static_cast<uint8_t>(flag)) != 0;
+        }
+
+        /**
+         * @brief Records an ALU operation instead of setting its flags, they are only computed once something reads them.
+         * @param operation The kind of operation, determines how the flags are derived.
+         * @param base The value inside the accumulator (or the INC/DEC operand) before the operation.
+         * @param operand The second operand of the operation.
+         * @param result The 8 bit result of the operation.
+         * @param carryIn The carry going into the operation, or the preserved carry flag for INC/DEC.
+         */
+        void SetFlagsLazy(LazyFlagOperation operation, uint8_t base, uint8_t operand, uint8_t result, uint8_t carryIn = 0)
+        {
+            lazyFlags = LazyFlags { operation, base, operand, result, carryIn };
+        }
+
+        /**
+         * @brief Returns the upper nibble of the F register, computed from the pending ALU operation if there is one.
+         */
+        uint8_t ComputeFlags() const;
+
+        /**
+         * @brief Writes the flags of the pending ALU operation to the F register.
+         * 
+         * Has to be called before anything accesses the F register directly (PUSH AF, POP AF, save states, ...).
+         */
+        void MaterializeFlags()
+        {
+            if (lazyFlags.operation != LazyFlagOperation::None)
+            {
+                AF.SetLowByte((AF.LowByte() & 0x0F) | ComputeFlags());
+                lazyFlags.operation = LazyFlagOperation::None;
+            }
+        }
 
         /**
          * @brief Returns the state of the emulator, DMG or CGB mode.
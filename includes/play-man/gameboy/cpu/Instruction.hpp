@@ -20,7 +20,6 @@
 #include <play-man/gameboy/opcodes/Opcodes.hpp>
 
 #include <optional>
-#include <functional>
 #include <iostream>
 
 namespace GameBoy
@@ -35,13 +34,13 @@ namespace GameBoy
 		friend void to_json(nlohmann::json& j, const Instruction& instruction);
 		friend std::ostream& operator << (std::ostream& os, Instruction& i);
 
-		using InstructionPrototype = std::function<size_t(Cpu*)>; /* Prototype of instrution, returns number of cycles it took. */
+		using InstructionPrototype = size_t (*)(Cpu*); /* Prototype of instrution, returns number of cycles it took. */
 
 	private:
 
 		OpCode opCode; /*! <-. */
 		std::optional<PrefixedOpCode> prefixedOpCode; /*!< -. */
-		InstructionPrototype instructionToExecute; /*!< Bound function from the InstructionTable. */
+		InstructionPrototype instructionToExecute; /*!< Handler taken from the InstructionTable. */
 		bool hasBeenExecuted;
 
 	public:
@@ -0,0 +1,94 @@
+// ****************************************************************************** //
+//   _______   __                              __       __                        //
+//  /       \ /  |                            /  \     /  |                       //
+//  $$$$$$$  |$$ |  ______   __    __         $$  \   /$$ |  ______   _______     //
+//  $$ |__$$ |$$ | /      \ /  |  /  | ______ $$$  \ /$$$ | /      \ /       \    //
+//  $$    $$/ $$ | $$$$$$  |$$ |  $$ |/      |$$$$  /$$$$ | $$$$$$  |$$$$$$$  |   //
+//  $$$$$$$/  $$ | /    $$ |$$ |  $$ |$$$$$$/ $$ $$ $$/$$ | /    $$ |$$ |  $$ |   //
+//  $$ |      $$ |/$$$$$$$ |$$ \__$$ |        $$ |$$$/ $$ |/$$$$$$$ |$$ |  $$ |   //
+//  $$ |      $$ |$$    $$ |$$    $$ |        $$ | $/  $$ |$$    $$ |$$ |  $$ |   //
+//  $$/       $$/  $$$$$$$/  $$$$$$$ |        $$/      $$/  $$$$$$$/ $$/   $$/    //
+//                          /  \__$$ |                                            //
+//                          $$    $$/                                             //
+//                           $$$$$$/                                              //
+//                                                                                //
+//                            By: K1ngmar and rvan-mee                            //
+// ****************************************************************************** //
+
+#pragma once
+
+#if defined(PLAY_MAN_JIT)
+
+#if !defined(__x86_64__) || !(defined(__linux__) || defined(__APPLE__))
+	#error "PLAY_MAN_JIT requires an x86-64 host with POSIX mmap"
+#endif
+
+#include <play-man/gameboy/cpu/BlockCache.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace GameBoy
+{
+	class Cpu;
+
+	/**
+	 * @brief The amount of times a block has to be entered before it gets translated.
+	 */
+	constexpr uint32_t jitHotBlockThreshold = 16;
+
+	/**
+	 * @brief Translates decoded blocks to x86-64 machine code.
+	 * 
+	 * NOP, the register loads, the 8 bit ALU operations, INC/DEC and the jumps ending a block are emitted
+	 * inline: they work on the cpu's registers and lazy flags in place and only keep the program counter
+	 * and cycle counter up to date where something can observe them. Memory accesses, I/O and the other
+	 * instructions still call their handler. A block jumping back to its own start keeps looping inside
+	 * the translated code until the budget runs out.
+	 * 
+	 * @note The code buffer is never writable and executable at the same time.
+	 */
+	class Jit
+	{
+		uint8_t* code = nullptr; /*!< The executable code buffer, mapped on the first translation. */
+		size_t used = 0; /*!< The amount of bytes of the code buffer that contain translated blocks. */
+		bool full = false; /*!< Whether a block did not fit into the code buffer anymore. */
+
+	public:
+
+		/**
+		 * @brief The size of the code buffer, see Full.
+		 */
+		static constexpr size_t codeBufferSize = 1024 * 1024;
+
+		Jit() = default;
+		~Jit();
+
+		Jit(const Jit&) = delete;
+		Jit& operator=(const Jit&) = delete;
+
+		/**
+		 * @brief Translates the block, the cpu's program counter has to point at its start.
+		 * 
+		 * @param block The block to translate.
+		 * @param cpu The cpu the translated block runs on.
+		 * @return The translated block, nullptr when it could not be translated.
+		 */
+		NativeBlock Compile(const DecodedBlock& block, Cpu& cpu);
+
+		/**
+		 * @brief Whether the code buffer ran full, no more blocks get translated until Clear is called.
+		 */
+		bool Full() const
+		{
+			return full;
+		}
+
+		/**
+		 * @brief Drops all translated blocks, previously returned NativeBlocks can no longer be called.
+		 */
+		void Clear();
+	};
+}
+
+#endif
@@ -53,43 +53,64 @@ namespace GameBoy
 		 * @brief -.
 		 * @param initialValue 
 		 */
-		Register(uint16_t initialValue = 0x0000);
+		Register(uint16_t initialValue = 0x0000)
+		{
+			internalRegister.value = initialValue;
+		}
 
 		/**
 		 * @brief -.
 		 * @param value 
 		 */
-		void SetLowByte(uint8_t value);
+		void SetLowByte(uint8_t value)
+		{
+			internalRegister.byte.low = value;
+		}
 
 		/**
 		 * @brief -.
 		 * @param value 
 		 */
-		void SetHighByte(uint8_t value);
+		void SetHighByte(uint8_t value)
+		{
+			internalRegister.byte.high = value;
+		}
 
 		/**
 		 * @brief -.
 		 * @param value 
 		 */
-		void SetValue(uint16_t value);
+		void SetValue(uint16_t value)
+		{
+			internalRegister.value = value;
+		}
 
 		/**
 		 * @brief -.
 		 * @return uint8_t 
 		 */
-		uint8_t LowByte() const;
+		uint8_t LowByte() const
+		{
+			return internalRegister.byte.low;
+		}
 
 		/**
 		 * @brief -.
 		 * @return uint8_t 
 		 */
-		uint8_t HighByte() const;
+		uint8_t HighByte() const
+		{
+			return internalRegister.byte.high;
+		}
 
 		/**
 		 * @brief -.
 		 * @return uint16_t 
 		 */
-		uint16_t Value() const;
+		uint16_t Value() const
+		{
+			return internalRegister.value;
+		}
 
 		// Postfix increment 
 		Register operator++(int)
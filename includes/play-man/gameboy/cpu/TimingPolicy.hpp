@@ -0,0 +1,69 @@
+// ****************************************************************************** //
+//   _______   __                              __       __                        //
+//  /       \ /  |                            /  \     /  |                       //
+//  $$$$$$$  |$$ |  ______   __    __         $$  \   /$$ |  ______   _______     //
+//  $$ |__$$ |$$ | /      \ /  |  /  | ______ $$$  \ /$$$ | /      \ /       \    //
+//  $$    $$/ $$ | $$$$$$  |$$ |  $$ |/      |$$$$  /$$$$ | $$$$$$  |$$$$$$$  |   //
+//  $$$$$$$/  $$ | /    $$ |$$ |  $$ |$$$$$$/ $$ $$ $$/$$ | /    $$ |$$ |  $$ |   //
+//  $$ |      $$ |/$$$$$$$ |$$ \__$$ |        $$ |$$$/ $$ |/$$$$$$$ |$$ |  $$ |   //
+//  $$ |      $$ |$$    $$ |$$    $$ |        $$ | $/  $$ |$$    $$ |$$ |  $$ |   //
+//  $$/       $$/  $$$$$$$/  $$$$$$$ |        $$/      $$/  $$$$$$$/ $$/   $$/    //
+//                          /  \__$$ |                                            //
+//                          $$    $$/                                             //
+//                           $$$$$$/                                              //
+//                                                                                //
+//                            By: K1ngmar and rvan-mee                            //
+// ****************************************************************************** //
+
+#pragma once
+
+#include <play-man/gameboy/memory/MemoryBus.hpp>
+
+#include <stddef.h>
+
+namespace GameBoy
+{
+	/**
+	 * @brief Timing policy of the dispatch loops for TimingAccuracy::Fast.
+	 * 
+	 * Time advances once per instruction, memory accesses in the middle of an instruction see
+	 * the other components as they were at the start of it.
+	 */
+	struct FastTiming
+	{
+		/**
+		 * @brief Whether every memory access advances the cpu's cycle counter by a machine cycle.
+		 */
+		static constexpr bool advancesPerAccess = false;
+
+		/**
+		 * @brief Advances the cycle counter past the instruction that has just been executed.
+		 * 
+		 * @param cycles The cpu's cycle counter.
+		 * @param instructionCycles The amount of cycles returned by the instruction.
+		 */
+		static void Retire(size_t& cycles, MemoryBus&, size_t instructionCycles)
+		{
+			cycles += instructionCycles;
+		}
+	};
+
+	/**
+	 * @brief Timing policy of the dispatch loops for TimingAccuracy::Accurate.
+	 * 
+	 * Every memory access goes through the memory bus' slow path, which advances the cycle counter by
+	 * a machine cycle before it accesses the memory, after the instruction only its internal cycles remain.
+	 */
+	struct AccurateTiming
+	{
+		static constexpr bool advancesPerAccess = true;
+
+		static void Retire(size_t& cycles, MemoryBus& memoryBus, size_t instructionCycles)
+		{
+			const size_t accessCycles = memoryBus.TakeAccessCycles();
+
+			if (instructionCycles > accessCycles)
+				cycles += instructionCycles - accessCycles;
+		}
+	};
+}
@@ -15,12 +15,12 @@
 //                            By: K1ngmar and rvan-mee                            //
 // ****************************************************************************** //
 
-#include <play-man/gameboy/cpu/Cpu.hpp>
+#pragma once
 
 namespace GameBoy
 {
-
-    size_t Cpu::BitComplementToZeroFlag(uint8_t bitMask, RegisterPointer reg, RegisterGet8Bit GetValue)
+    template<uint8_t bitMask, RegisterPointer reg, RegisterGet8Bit GetValue>
+    size_t Cpu::BitComplementToZeroFlag()
     {
         Register& r = core.*reg;
         const uint8_t value = (r.*GetValue)();
@@ -34,7 +34,8 @@ namespace GameBoy
         return numberOfCycles;
     }
 
-    size_t Cpu::BitComplementToZeroFlag_Addr(uint8_t bitMask, RegisterPointer addrReg)
+    template<uint8_t bitMask, RegisterPointer addrReg>
+    size_t Cpu::BitComplementToZeroFlag_Addr()
     {
         const uint16_t address = (core.*addrReg).Value();
         const uint8_t value = memoryBus.ReadByte(address);
@@ -48,7 +49,8 @@ namespace GameBoy
         return numberOfCycles;
     }
 
-    size_t Cpu::BitReset(uint8_t bitMask, RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue)
+    template<uint8_t bitMask, RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+    size_t Cpu::BitReset()
     {
         Register& r = core.*reg;
         const uint8_t value = (r.*GetValue)();
@@ -60,7 +62,8 @@ namespace GameBoy
         return numberOfCycles;
     }
 
-    size_t Cpu::BitReset_Addr(uint8_t bitMask, RegisterPointer addrReg)
+    template<uint8_t bitMask, RegisterPointer addrReg>
+    size_t Cpu::BitReset_Addr()
     {
         const uint16_t address = (core.*addrReg).Value();
         const uint8_t value = memoryBus.ReadByte(address);
@@ -72,7 +75,8 @@ namespace GameBoy
         return numberOfCycles;
     }
 
-    size_t Cpu::BitSet(uint8_t bitMask, RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue)
+    template<uint8_t bitMask, RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+    size_t Cpu::BitSet()
     {
         Register& r = core.*reg;
         const uint8_t value = (r.*GetValue)();
@@ -84,7 +88,8 @@ namespace GameBoy
         return numberOfCycles;
     }
 
-    size_t Cpu::BitSet_Addr(uint8_t bitMask, RegisterPointer addrReg)
+    template<uint8_t bitMask, RegisterPointer addrReg>
+    size_t Cpu::BitSet_Addr()
     {
         const uint16_t address = (core.*addrReg).Value();
         const uint8_t value = memoryBus.ReadByte(address);
@@ -96,4 +101,4 @@ namespace GameBoy
         return numberOfCycles;
     }
 
-}
+} // namespace GameBoy
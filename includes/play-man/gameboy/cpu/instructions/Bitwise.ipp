@@ -0,0 +1,115 @@
+// ****************************************************************************** //
+//   _______   __                              __       __                        //
+//  /       \ /  |                            /  \     /  |                       //
+//  $$$$$$$  |$$ |  ______   __    __         $$  \   /$$ |  ______   _______     //
+//  $$ |__$$ |$$ | /      \ /  |  /  | ______ $$$  \ /$$$ | /      \ /       \    //
+//  $$    $$/ $$ | $$$$$$  |$$ |  $$ |/      |$$$$  /$$$$ | $$$$$$  |$$$$$$$  |   //
+//  $$$$$$$/  $$ | /    $$ |$$ |  $$ |$$$$$$/ $$ $$ $$/$$ | /    $$ |$$ |  $$ |   //
+//  $$ |      $$ |/$$$$$$$ |$$ \__$$ |        $$ |$$$/ $$ |/$$$$$$$ |$$ |  $$ |   //
+//  $$ |      $$ |$$    $$ |$$    $$ |        $$ | $/  $$ |$$    $$ |$$ |  $$ |   //
+//  $$/       $$/  $$$$$$$/  $$$$$$$ |        $$/      $$/  $$$$$$$/ $$/   $$/    //
+//                          /  \__$$ |                                            //
+//                          $$    $$/                                             //
+//                           $$$$$$/                                              //
+//                                                                                //
+//                            By: K1ngmar and rvan-mee                            //
+// ****************************************************************************** //
+
+#pragma once
+
+namespace GameBoy
+{
+    template<RegisterPointer reg, RegisterGet8Bit GetOperand>
+    size_t Cpu::BitwiseAnd()
+    {
+        const uint8_t baseValue = core.AF.HighByte();
+        const uint8_t operandValue = ((core.*reg).*GetOperand)();
+        const uint8_t result = baseValue & operandValue;
+
+        core.AF.SetHighByte(result);
+
+        core.SetFlagsLazy(LazyFlagOperation::And, baseValue, operandValue, result);
+
+        constexpr size_t numberOfCycles = 1;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer addrReg>
+    size_t Cpu::BitwiseAnd_Addr()
+    {
+        const uint16_t address = (core.*addrReg).Value();
+        const uint8_t  baseValue = core.AF.HighByte();
+        const uint8_t  operandValue = memoryBus.ReadByte(address);
+        const uint8_t  result = baseValue & operandValue;
+
+        core.AF.SetHighByte(result);
+
+        core.SetFlagsLazy(LazyFlagOperation::And, baseValue, operandValue, result);
+
+        constexpr size_t numberOfCycles = 2;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer reg, RegisterGet8Bit GetOperand>
+    size_t Cpu::BitwiseXor()
+    {
+        const uint8_t baseValue = core.AF.HighByte();
+        const uint8_t operandValue = ((core.*reg).*GetOperand)();
+        const uint8_t result = baseValue ^ operandValue;
+
+        core.AF.SetHighByte(result);
+
+        core.SetFlagsLazy(LazyFlagOperation::Or, baseValue, operandValue, result);
+
+        constexpr size_t numberOfCycles = 1;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer addrReg>
+    size_t Cpu::BitwiseXor_Addr()
+    {
+        const uint16_t address = (core.*addrReg).Value();
+        const uint8_t  baseValue = core.AF.HighByte();
+        const uint8_t  operandValue = memoryBus.ReadByte(address);
+        const uint8_t  result = baseValue ^ operandValue;
+
+        core.AF.SetHighByte(result);
+
+        core.SetFlagsLazy(LazyFlagOperation::Or, baseValue, operandValue, result);
+
+        constexpr size_t numberOfCycles = 2;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer reg, RegisterGet8Bit GetOperand>
+    size_t Cpu::BitwiseOr()
+    {
+        const uint8_t baseValue = core.AF.HighByte();
+        const uint8_t operandValue = ((core.*reg).*GetOperand)();
+        const uint8_t result = baseValue | operandValue;
+
+        core.AF.SetHighByte(result);
+
+        core.SetFlagsLazy(LazyFlagOperation::Or, baseValue, operandValue, result);
+
+        constexpr size_t numberOfCycles = 1;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer addrReg>
+    size_t Cpu::BitwiseOr_Addr()
+    {
+        const uint16_t address = (core.*addrReg).Value();
+        const uint8_t  baseValue = core.AF.HighByte();
+        const uint8_t  operandValue = memoryBus.ReadByte(address);
+        const uint8_t  result = baseValue | operandValue;
+
+        core.AF.SetHighByte(result);
+
+        core.SetFlagsLazy(LazyFlagOperation::Or, baseValue, operandValue, result);
+
+        constexpr size_t numberOfCycles = 2;
+        return numberOfCycles;
+    }
+
+} // namespace GameBoy
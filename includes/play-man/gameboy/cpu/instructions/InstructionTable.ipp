@@ -0,0 +1,462 @@
+// ****************************************************************************** //
+//   _______   __                              __       __                        //
+//  /       \ /  |                            /  \     /  |                       //
+//  $$$$$$$  |$$ |  ______   __    __         $$  \   /$$ |  ______   _______     //
+//  $$ |__$$ |$$ | /      \ /  |  /  | ______ $$$  \ /$$$ | /      \ /       \    //
+//  $$    $$/ $$ | $$$$$$  |$$ |  $$ |/      |$$$$  /$$$$ | $$$$$$  |$$$$$$$  |   //
+//  $$$$$$$/  $$ | /    $$ |$$ |  $$ |$$$$$$/ $$ $$ $$/$$ | /    $$ |$$ |  $$ |   //
+//  $$ |      $$ |/$$$$$$$ |$$ \__$$ |        $$ |$$$/ $$ |/$$$$$$$ |$$ |  $$ |   //
+//  $$ |      $$ |$$    $$ |$$    $$ |        $$ | $/  $$ |$$    $$ |$$ |  $$ |   //
+//  $$/       $$/  $$$$$$$/  $$$$$$$ |        $$/      $$/  $$$$$$$/ $$/   $$/    //
+//                          /  \__$$ |                                            //
+//                          $$    $$/                                             //
+//                           $$$$$$/                                              //
+//                                                                                //
+//                            By: K1ngmar and rvan-mee                            //
+// ****************************************************************************** //
+
+#pragma once
+
+/**
+ * Builders of the instruction tables. Not included by Cpu.hpp: only the translation units
+ * that need the tables as compile time constants include this file.
+ */
+
+#include <utility>
+
+namespace GameBoy
+{
+	#define RegisterBC &CpuCore::BC
+	#define RegisterDE &CpuCore::DE
+	#define RegisterHL &CpuCore::HL
+	#define RegisterAF &CpuCore::AF
+	#define RegisterSP &CpuCore::SP
+
+	#define GetB RegisterBC, &Register::HighByte
+	#define GetC RegisterBC, &Register::LowByte
+	#define GetD RegisterDE, &Register::HighByte
+	#define GetE RegisterDE, &Register::LowByte
+	#define GetH RegisterHL, &Register::HighByte
+	#define GetL RegisterHL, &Register::LowByte
+	#define GetA RegisterAF, &Register::HighByte
+
+	#define SetB RegisterBC, &Register::SetHighByte
+	#define SetC RegisterBC, &Register::SetLowByte
+	#define SetD RegisterDE, &Register::SetHighByte
+	#define SetE RegisterDE, &Register::SetLowByte
+	#define SetH RegisterHL, &Register::SetHighByte
+	#define SetL RegisterHL, &Register::SetLowByte
+	#define SetA RegisterAF, &Register::SetHighByte
+
+	#define GetSetB RegisterBC, &Register::HighByte, &Register::SetHighByte
+	#define GetSetC RegisterBC, &Register::LowByte, &Register::SetLowByte
+	#define GetSetD RegisterDE, &Register::HighByte, &Register::SetHighByte
+	#define GetSetE RegisterDE, &Register::LowByte, &Register::SetLowByte
+	#define GetSetH RegisterHL, &Register::HighByte, &Register::SetHighByte
+	#define GetSetL RegisterHL, &Register::LowByte, &Register::SetLowByte
+	#define GetSetA RegisterAF, &Register::HighByte, &Register::SetHighByte
+
+
+	constexpr Cpu::InstructionTable Cpu::MakeInstructionTable()
+	{
+		InstructionTable table{};
+
+		// 0x0-
+		table[OpCode::NOP]            = &Invoke<&Cpu::NOP>;
+		table[OpCode::LD_BC_n16]      = &Invoke<&Cpu::Load_16bit_ImmediateData<RegisterBC>>;
+		table[OpCode::LD_BC_NI_A]     = &Invoke<&Cpu::Store_8bit_Addr<RegisterBC, GetA>>;
+		table[OpCode::INC_BC]         = &Invoke<&Cpu::Increment_16bit<RegisterBC>>;
+		table[OpCode::INC_B]          = &Invoke<&Cpu::Increment_8bit<GetSetB>>;
+		table[OpCode::DEC_B]          = &Invoke<&Cpu::Decrement_8bit<GetSetB>>;
+		table[OpCode::LD_B_n8]        = &Invoke<&Cpu::Load_8bit_ImmediateData<SetB>>;
+		table[OpCode::RLCA]           = &Invoke<&Cpu::NoPrefixRotateLeftCarry<GetSetA>>;
+		table[OpCode::LD_a16_NI_SP]   = &Invoke<&Cpu::Load_16bit_RegToImmediateAddr<RegisterSP>>;
+		table[OpCode::ADD_HL_BC]      = &Invoke<&Cpu::Add_16bit<RegisterHL, RegisterBC>>;
+		table[OpCode::LD_A_BC_NI]     = &Invoke<&Cpu::Load_8bit_Addr<SetA, RegisterBC>>;
+		table[OpCode::DEC_BC]         = &Invoke<&Cpu::Decrement_16bit<RegisterBC>>;
+		table[OpCode::INC_C]          = &Invoke<&Cpu::Increment_8bit<GetSetC>>;
+		table[OpCode::DEC_C]          = &Invoke<&Cpu::Decrement_8bit<GetSetC>>;
+		table[OpCode::LD_C_n8]        = &Invoke<&Cpu::Load_8bit_ImmediateData<SetC>>;
+		table[OpCode::RRCA]           = &Invoke<&Cpu::NoPrefixRotateRightCarry<GetSetA>>;
+
+		// 0x1-
+			// 0x10
+			// TODO: STOP, implement when PPU/LCD and input register have been implemented;
+			// https://gbdev.io/pandocs/Reducing_Power_Consumption.html#using-the-stop-instruction
+		table[OpCode::LD_DE_n16]      = &Invoke<&Cpu::Load_16bit_ImmediateData<RegisterDE>>;
+		table[OpCode::LD_DE_NI_A]     = &Invoke<&Cpu::Store_8bit_Addr<RegisterDE, GetA>>;
+		table[OpCode::INC_DE]         = &Invoke<&Cpu::Increment_16bit<RegisterDE>>;
+		table[OpCode::INC_D]          = &Invoke<&Cpu::Increment_8bit<GetSetD>>;
+		table[OpCode::DEC_D]          = &Invoke<&Cpu::Decrement_8bit<GetSetD>>;
+		table[OpCode::LD_D_n8]        = &Invoke<&Cpu::Load_8bit_ImmediateData<SetD>>;
+		table[OpCode::RLA]            = &Invoke<&Cpu::NoPrefixRotateLeft<GetSetA>>;
+		table[OpCode::JR_e8]          = &Invoke<&Cpu::Jump_Relative_8bit_SignedImmediateData>;
+		table[OpCode::ADD_HL_DE]      = &Invoke<&Cpu::Add_16bit<RegisterHL, RegisterDE>>;
+		table[OpCode::LD_A_DE_NI]     = &Invoke<&Cpu::Load_8bit_Addr<SetA, RegisterDE>>;
+		table[OpCode::DEC_DE]         = &Invoke<&Cpu::Decrement_16bit<RegisterDE>>;
+		table[OpCode::INC_E]          = &Invoke<&Cpu::Increment_8bit<GetSetE>>;
+		table[OpCode::DEC_E]          = &Invoke<&Cpu::Decrement_8bit<GetSetE>>;
+		table[OpCode::LD_E_n8]        = &Invoke<&Cpu::Load_8bit_ImmediateData<SetE>>;
+		table[OpCode::RRA]            = &Invoke<&Cpu::NoPrefixRotateRight<GetSetA>>;
+
+		// 0x2-
+		table[OpCode::JR_NZ_e8]       = &Invoke<&Cpu::Jump_Relative_Conditional_8bit_SignedImmediateData, FlagRegisterFlag::ZERO, false>;
+		table[OpCode::LD_HL_n16]      = &Invoke<&Cpu::Load_16bit_ImmediateData<RegisterHL>>;
+		table[OpCode::LD_HL_INC_NI_A] = &Invoke<&Cpu::Store_8bit_AddrIncrement<RegisterHL, GetA>>;
+		table[OpCode::INC_HL]         = &Invoke<&Cpu::Increment_16bit<RegisterHL>>;
+		table[OpCode::INC_H]          = &Invoke<&Cpu::Increment_8bit<GetSetH>>;
+		table[OpCode::DEC_H]          = &Invoke<&Cpu::Decrement_8bit<GetSetH>>;
+		table[OpCode::LD_H_n8]        = &Invoke<&Cpu::Load_8bit_ImmediateData<SetH>>;
+		table[OpCode::DAA]            = &Invoke<&Cpu::DDA>;
+		table[OpCode::JR_Z_e8]        = &Invoke<&Cpu::Jump_Relative_Conditional_8bit_SignedImmediateData, FlagRegisterFlag::ZERO, true>;
+		table[OpCode::ADD_HL_HL]      = &Invoke<&Cpu::Add_16bit<RegisterHL, RegisterHL>>;
+		table[OpCode::LD_A_HL_INC_NI] = &Invoke<&Cpu::Load_8bit_AddrIncrement<SetA, RegisterHL>>;
+		table[OpCode::DEC_HL]         = &Invoke<&Cpu::Decrement_16bit<RegisterHL>>;
+		table[OpCode::INC_L]          = &Invoke<&Cpu::Increment_8bit<GetSetL>>;
+		table[OpCode::DEC_L]          = &Invoke<&Cpu::Decrement_8bit<GetSetL>>;
+		table[OpCode::LD_L_n8]        = &Invoke<&Cpu::Load_8bit_ImmediateData<SetL>>;
+		table[OpCode::CPL]            = &Invoke<&Cpu::CPL>;
+
+		// 0x3-
+		table[OpCode::JR_NC_e8]       = &Invoke<&Cpu::Jump_Relative_Conditional_8bit_SignedImmediateData, FlagRegisterFlag::CARRY, false>;
+		table[OpCode::LD_SP_n16]      = &Invoke<&Cpu::Load_16bit_ImmediateData<RegisterSP>>;
+		table[OpCode::LD_HL_DEC_NI_A] = &Invoke<&Cpu::Store_8bit_AddrDecrement<RegisterHL, GetA>>;
+		table[OpCode::INC_SP]         = &Invoke<&Cpu::Increment_16bit<RegisterSP>>;
+		table[OpCode::INC_HL_NI]      = &Invoke<&Cpu::Increment_Dereferenced<RegisterHL>>;
+		table[OpCode::DEC_HL_NI]      = &Invoke<&Cpu::Decrement_Dereferenced<RegisterHL>>;
+		table[OpCode::LD_HL_NI_n8]    = &Invoke<&Cpu::Store_8bit_Addr_ImmediateData<RegisterHL>>;
+		table[OpCode::SCF]            = &Invoke<&Cpu::SCF>;
+		table[OpCode::JR_C_e8]        = &Invoke<&Cpu::Jump_Relative_Conditional_8bit_SignedImmediateData, FlagRegisterFlag::CARRY, true>;
+		table[OpCode::ADD_HL_SP]      = &Invoke<&Cpu::Add_16bit<RegisterHL, RegisterSP>>;
+		table[OpCode::LD_A_HL_DEC_NI] = &Invoke<&Cpu::Load_8bit_AddrDecrement<SetA, RegisterHL>>;
+		table[OpCode::DEC_SP]         = &Invoke<&Cpu::Decrement_16bit<RegisterSP>>;
+		table[OpCode::INC_A]          = &Invoke<&Cpu::Increment_8bit<GetSetA>>;
+		table[OpCode::DEC_A]          = &Invoke<&Cpu::Decrement_8bit<GetSetA>>;
+		table[OpCode::LD_A_n8]        = &Invoke<&Cpu::Load_8bit_ImmediateData<SetA>>;
+		table[OpCode::CCF]            = &Invoke<&Cpu::CCF>;
+
+		// 0x4-
+		table[OpCode::LD_B_B]         = &Invoke<&Cpu::Load_8bit<SetB, GetB>>;
+		table[OpCode::LD_B_C]         = &Invoke<&Cpu::Load_8bit<SetB, GetC>>;
+		table[OpCode::LD_B_D]         = &Invoke<&Cpu::Load_8bit<SetB, GetD>>;
+		table[OpCode::LD_B_E]         = &Invoke<&Cpu::Load_8bit<SetB, GetE>>;
+		table[OpCode::LD_B_H]         = &Invoke<&Cpu::Load_8bit<SetB, GetH>>;
+		table[OpCode::LD_B_L]         = &Invoke<&Cpu::Load_8bit<SetB, GetL>>;
+		table[OpCode::LD_B_HL_NI]     = &Invoke<&Cpu::Load_8bit_Addr<SetB, RegisterHL>>;
+		table[OpCode::LD_B_A]         = &Invoke<&Cpu::Load_8bit<SetB, GetA>>;
+		table[OpCode::LD_C_B]         = &Invoke<&Cpu::Load_8bit<SetC, GetB>>;
+		table[OpCode::LD_C_C]         = &Invoke<&Cpu::Load_8bit<SetC, GetC>>;
+		table[OpCode::LD_C_D]         = &Invoke<&Cpu::Load_8bit<SetC, GetD>>;
+		table[OpCode::LD_C_E]         = &Invoke<&Cpu::Load_8bit<SetC, GetE>>;
+		table[OpCode::LD_C_H]         = &Invoke<&Cpu::Load_8bit<SetC, GetH>>;
+		table[OpCode::LD_C_L]         = &Invoke<&Cpu::Load_8bit<SetC, GetL>>;
+		table[OpCode::LD_C_HL_NI]     = &Invoke<&Cpu::Load_8bit_Addr<SetC, RegisterHL>>;
+		table[OpCode::LD_C_A]         = &Invoke<&Cpu::Load_8bit<SetC, GetA>>;
+
+		// 0x5-
+		table[OpCode::LD_D_B]         = &Invoke<&Cpu::Load_8bit<SetD, GetB>>;
+		table[OpCode::LD_D_C]         = &Invoke<&Cpu::Load_8bit<SetD, GetC>>;
+		table[OpCode::LD_D_D]         = &Invoke<&Cpu::Load_8bit<SetD, GetD>>;
+		table[OpCode::LD_D_E]         = &Invoke<&Cpu::Load_8bit<SetD, GetE>>;
+		table[OpCode::LD_D_H]         = &Invoke<&Cpu::Load_8bit<SetD, GetH>>;
+		table[OpCode::LD_D_L]         = &Invoke<&Cpu::Load_8bit<SetD, GetL>>;
+		table[OpCode::LD_D_HL_NI]     = &Invoke<&Cpu::Load_8bit_Addr<SetD, RegisterHL>>;
+		table[OpCode::LD_D_A]         = &Invoke<&Cpu::Load_8bit<SetD, GetA>>;
+		table[OpCode::LD_E_B]         = &Invoke<&Cpu::Load_8bit<SetE, GetB>>;
+		table[OpCode::LD_E_C]         = &Invoke<&Cpu::Load_8bit<SetE, GetC>>;
+		table[OpCode::LD_E_D]         = &Invoke<&Cpu::Load_8bit<SetE, GetD>>;
+		table[OpCode::LD_E_E]         = &Invoke<&Cpu::Load_8bit<SetE, GetE>>;
+		table[OpCode::LD_E_H]         = &Invoke<&Cpu::Load_8bit<SetE, GetH>>;
+		table[OpCode::LD_E_L]         = &Invoke<&Cpu::Load_8bit<SetE, GetL>>;
+		table[OpCode::LD_E_HL_NI]     = &Invoke<&Cpu::Load_8bit_Addr<SetE, RegisterHL>>;
+		table[OpCode::LD_E_A]         = &Invoke<&Cpu::Load_8bit<SetE, GetA>>;
+
+		// 0x6-
+		table[OpCode::LD_H_B]         = &Invoke<&Cpu::Load_8bit<SetH, GetB>>;
+		table[OpCode::LD_H_C]         = &Invoke<&Cpu::Load_8bit<SetH, GetC>>;
+		table[OpCode::LD_H_D]         = &Invoke<&Cpu::Load_8bit<SetH, GetD>>;
+		table[OpCode::LD_H_E]         = &Invoke<&Cpu::Load_8bit<SetH, GetE>>;
+		table[OpCode::LD_H_H]         = &Invoke<&Cpu::Load_8bit<SetH, GetH>>;
+		table[OpCode::LD_H_L]         = &Invoke<&Cpu::Load_8bit<SetH, GetL>>;
+		table[OpCode::LD_H_HL_NI]     = &Invoke<&Cpu::Load_8bit_Addr<SetH, RegisterHL>>;
+		table[OpCode::LD_H_A]         = &Invoke<&Cpu::Load_8bit<SetH, GetA>>;
+		table[OpCode::LD_L_B]         = &Invoke<&Cpu::Load_8bit<SetL, GetB>>;
+		table[OpCode::LD_L_C]         = &Invoke<&Cpu::Load_8bit<SetL, GetC>>;
+		table[OpCode::LD_L_D]         = &Invoke<&Cpu::Load_8bit<SetL, GetD>>;
+		table[OpCode::LD_L_E]         = &Invoke<&Cpu::Load_8bit<SetL, GetE>>;
+		table[OpCode::LD_L_H]         = &Invoke<&Cpu::Load_8bit<SetL, GetH>>;
+		table[OpCode::LD_L_L]         = &Invoke<&Cpu::Load_8bit<SetL, GetL>>;
+		table[OpCode::LD_L_HL_NI]     = &Invoke<&Cpu::Load_8bit_Addr<SetL, RegisterHL>>;
+		table[OpCode::LD_L_A]         = &Invoke<&Cpu::Load_8bit<SetL, GetA>>;
+
+		// 0x7-
+		table[OpCode::LD_HL_NI_B]     = &Invoke<&Cpu::Store_8bit_Addr<RegisterHL, GetB>>;
+		table[OpCode::LD_HL_NI_C]     = &Invoke<&Cpu::Store_8bit_Addr<RegisterHL, GetC>>;
+		table[OpCode::LD_HL_NI_D]     = &Invoke<&Cpu::Store_8bit_Addr<RegisterHL, GetD>>;
+		table[OpCode::LD_HL_NI_E]     = &Invoke<&Cpu::Store_8bit_Addr<RegisterHL, GetE>>;
+		table[OpCode::LD_HL_NI_H]     = &Invoke<&Cpu::Store_8bit_Addr<RegisterHL, GetH>>;
+		table[OpCode::LD_HL_NI_L]     = &Invoke<&Cpu::Store_8bit_Addr<RegisterHL, GetL>>;
+		table[OpCode::HALT]           = &Invoke<&Cpu::Halt>;
+		table[OpCode::LD_HL_NI_A]     = &Invoke<&Cpu::Store_8bit_Addr<RegisterHL, GetA>>;
+		table[OpCode::LD_A_B]         = &Invoke<&Cpu::Load_8bit<SetA, GetB>>;
+		table[OpCode::LD_A_C]         = &Invoke<&Cpu::Load_8bit<SetA, GetC>>;
+		table[OpCode::LD_A_D]         = &Invoke<&Cpu::Load_8bit<SetA, GetD>>;
+		table[OpCode::LD_A_E]         = &Invoke<&Cpu::Load_8bit<SetA, GetE>>;
+		table[OpCode::LD_A_H]         = &Invoke<&Cpu::Load_8bit<SetA, GetH>>;
+		table[OpCode::LD_A_L]         = &Invoke<&Cpu::Load_8bit<SetA, GetL>>;
+		table[OpCode::LD_A_HL_NI]     = &Invoke<&Cpu::Load_8bit_Addr<SetA, RegisterHL>>;
+		table[OpCode::LD_A_A]         = &Invoke<&Cpu::Load_8bit<SetA, GetA>>;
+
+		// 0x8-
+		table[OpCode::ADD_A_B]        = &Invoke<&Cpu::Add_8bit<GetB>>;
+		table[OpCode::ADD_A_C]        = &Invoke<&Cpu::Add_8bit<GetC>>;
+		table[OpCode::ADD_A_D]        = &Invoke<&Cpu::Add_8bit<GetD>>;
+		table[OpCode::ADD_A_E]        = &Invoke<&Cpu::Add_8bit<GetE>>;
+		table[OpCode::ADD_A_H]        = &Invoke<&Cpu::Add_8bit<GetH>>;
+		table[OpCode::ADD_A_L]        = &Invoke<&Cpu::Add_8bit<GetL>>;
+		table[OpCode::ADD_A_HL_NI]    = &Invoke<&Cpu::Add_8bit_Addr<RegisterHL>>;
+		table[OpCode::ADD_A_A]        = &Invoke<&Cpu::Add_8bit<GetA>>;
+		table[OpCode::ADC_A_B]        = &Invoke<&Cpu::AddCarry_8bit<GetB>>;
+		table[OpCode::ADC_A_C]        = &Invoke<&Cpu::AddCarry_8bit<GetC>>;
+		table[OpCode::ADC_A_D]        = &Invoke<&Cpu::AddCarry_8bit<GetD>>;
+		table[OpCode::ADC_A_E]        = &Invoke<&Cpu::AddCarry_8bit<GetE>>;
+		table[OpCode::ADC_A_H]        = &Invoke<&Cpu::AddCarry_8bit<GetH>>;
+		table[OpCode::ADC_A_L]        = &Invoke<&Cpu::AddCarry_8bit<GetL>>;
+		table[OpCode::ADC_A_HL_NI]    = &Invoke<&Cpu::AddCarry_8bit_Addr<RegisterHL>>;
+		table[OpCode::ADC_A_A]        = &Invoke<&Cpu::AddCarry_8bit<GetA>>;
+
+		// 0x9-
+		table[OpCode::SUB_A_B]        = &Invoke<&Cpu::Sub_8bit<GetB>>;
+		table[OpCode::SUB_A_C]        = &Invoke<&Cpu::Sub_8bit<GetC>>;
+		table[OpCode::SUB_A_D]        = &Invoke<&Cpu::Sub_8bit<GetD>>;
+		table[OpCode::SUB_A_E]        = &Invoke<&Cpu::Sub_8bit<GetE>>;
+		table[OpCode::SUB_A_H]        = &Invoke<&Cpu::Sub_8bit<GetH>>;
+		table[OpCode::SUB_A_L]        = &Invoke<&Cpu::Sub_8bit<GetL>>;
+		table[OpCode::SUB_A_HL_NI]    = &Invoke<&Cpu::Sub_8bit_Addr<RegisterHL>>;
+		table[OpCode::SUB_A_A]        = &Invoke<&Cpu::Sub_8bit<GetA>>;
+		table[OpCode::SBC_A_B]        = &Invoke<&Cpu::SubCarry_8bit<GetB>>;
+		table[OpCode::SBC_A_C]        = &Invoke<&Cpu::SubCarry_8bit<GetC>>;
+		table[OpCode::SBC_A_D]        = &Invoke<&Cpu::SubCarry_8bit<GetD>>;
+		table[OpCode::SBC_A_E]        = &Invoke<&Cpu::SubCarry_8bit<GetE>>;
+		table[OpCode::SBC_A_H]        = &Invoke<&Cpu::SubCarry_8bit<GetH>>;
+		table[OpCode::SBC_A_L]        = &Invoke<&Cpu::SubCarry_8bit<GetL>>;
+		table[OpCode::SBC_A_HL_NI]    = &Invoke<&Cpu::SubCarry_8bit_Addr<RegisterHL>>;
+		table[OpCode::SBC_A_A]        = &Invoke<&Cpu::SubCarry_8bit<GetA>>;
+
+		// 0xA-
+		table[OpCode::AND_A_B]        = &Invoke<&Cpu::BitwiseAnd<GetB>>;
+		table[OpCode::AND_A_C]        = &Invoke<&Cpu::BitwiseAnd<GetC>>;
+		table[OpCode::AND_A_D]        = &Invoke<&Cpu::BitwiseAnd<GetD>>;
+		table[OpCode::AND_A_E]        = &Invoke<&Cpu::BitwiseAnd<GetE>>;
+		table[OpCode::AND_A_H]        = &Invoke<&Cpu::BitwiseAnd<GetH>>;
+		table[OpCode::AND_A_L]        = &Invoke<&Cpu::BitwiseAnd<GetL>>;
+		table[OpCode::AND_A_HL_NI]    = &Invoke<&Cpu::BitwiseAnd_Addr<RegisterHL>>;
+		table[OpCode::AND_A_A]        = &Invoke<&Cpu::BitwiseAnd<GetA>>;
+		table[OpCode::XOR_A_B]        = &Invoke<&Cpu::BitwiseXor<GetB>>;
+		table[OpCode::XOR_A_C]        = &Invoke<&Cpu::BitwiseXor<GetC>>;
+		table[OpCode::XOR_A_D]        = &Invoke<&Cpu::BitwiseXor<GetD>>;
+		table[OpCode::XOR_A_E]        = &Invoke<&Cpu::BitwiseXor<GetE>>;
+		table[OpCode::XOR_A_H]        = &Invoke<&Cpu::BitwiseXor<GetH>>;
+		table[OpCode::XOR_A_L]        = &Invoke<&Cpu::BitwiseXor<GetL>>;
+		table[OpCode::XOR_A_HL_NI]    = &Invoke<&Cpu::BitwiseXor_Addr<RegisterHL>>;
+		table[OpCode::XOR_A_A]        = &Invoke<&Cpu::BitwiseXor<GetA>>;
+
+		// 0xB-
+		table[OpCode::OR_A_B]        = &Invoke<&Cpu::BitwiseOr<GetB>>;
+		table[OpCode::OR_A_C]        = &Invoke<&Cpu::BitwiseOr<GetC>>;
+		table[OpCode::OR_A_D]        = &Invoke<&Cpu::BitwiseOr<GetD>>;
+		table[OpCode::OR_A_E]        = &Invoke<&Cpu::BitwiseOr<GetE>>;
+		table[OpCode::OR_A_H]        = &Invoke<&Cpu::BitwiseOr<GetH>>;
+		table[OpCode::OR_A_L]        = &Invoke<&Cpu::BitwiseOr<GetL>>;
+		table[OpCode::OR_A_HL_NI]    = &Invoke<&Cpu::BitwiseOr_Addr<RegisterHL>>;
+		table[OpCode::OR_A_A]        = &Invoke<&Cpu::BitwiseOr<GetA>>;
+		table[OpCode::CP_A_B]        = &Invoke<&Cpu::Compare_8bit<GetB>>;
+		table[OpCode::CP_A_C]        = &Invoke<&Cpu::Compare_8bit<GetC>>;
+		table[OpCode::CP_A_D]        = &Invoke<&Cpu::Compare_8bit<GetD>>;
+		table[OpCode::CP_A_E]        = &Invoke<&Cpu::Compare_8bit<GetE>>;
+		table[OpCode::CP_A_H]        = &Invoke<&Cpu::Compare_8bit<GetH>>;
+		table[OpCode::CP_A_L]        = &Invoke<&Cpu::Compare_8bit<GetL>>;
+		table[OpCode::CP_A_HL_NI]    = &Invoke<&Cpu::Compare_8bit_Addr<RegisterHL>>;
+		table[OpCode::CP_A_A]        = &Invoke<&Cpu::Compare_8bit<GetA>>;
+
+		// 0xC-
+		table[OpCode::RET_NZ]      = &Invoke<&Cpu::ConditionalReturn, FlagRegisterFlag::ZERO, false>;
+		table[OpCode::POP_BC]      = &Invoke<&Cpu::Pop<RegisterBC>>;
+		table[OpCode::JP_NZ_a16]   = &Invoke<&Cpu::Jump_Conditional_16bit_ImmediateData, FlagRegisterFlag::ZERO, false>;
+		table[OpCode::JP_a16]      = &Invoke<&Cpu::Jump_16bit_ImmediateData>;
+		table[OpCode::CALL_NZ_a16] = &Invoke<&Cpu::ConditionalCall_16bit_ImmediateData, FlagRegisterFlag::ZERO, false>;
+		table[OpCode::PUSH_BC]     = &Invoke<&Cpu::Push<RegisterBC>>;
+		table[OpCode::ADD_A_n8]    = &Invoke<&Cpu::Add_8bit_ImmediateData>;
+		table[OpCode::RST_00]      = &Invoke<&Cpu::RST, 0x00>;
+		table[OpCode::RET_Z]       = &Invoke<&Cpu::ConditionalReturn, FlagRegisterFlag::ZERO, true>;
+		table[OpCode::RET]         = &Invoke<&Cpu::Return>;
+		table[OpCode::JP_Z_a16]    = &Invoke<&Cpu::Jump_Conditional_16bit_ImmediateData, FlagRegisterFlag::ZERO, true>;
+		// 0xCB reserved for prefixed instructions
+		table[OpCode::CALL_Z_a16]  = &Invoke<&Cpu::ConditionalCall_16bit_ImmediateData, FlagRegisterFlag::ZERO, true>;
+		table[OpCode::CALL_a16]    = &Invoke<&Cpu::Call_16bit_ImmediateData>;
+		table[OpCode::ADC_A_n8]    = &Invoke<&Cpu::AddCarry_8bit_ImmediateData>;
+		table[OpCode::RST_08]      = &Invoke<&Cpu::RST, 0x08>;
+
+		// 0xD-
+		table[OpCode::RET_NC]      = &Invoke<&Cpu::ConditionalReturn, FlagRegisterFlag::CARRY, false>;
+		table[OpCode::POP_DE]      = &Invoke<&Cpu::Pop<RegisterDE>>;
+		table[OpCode::JP_NC_a16]   = &Invoke<&Cpu::Jump_Conditional_16bit_ImmediateData, FlagRegisterFlag::CARRY, false>;
+		table[OpCode::ILLEGAL_D3]  = &Invoke<&Cpu::HardLock>;
+		table[OpCode::CALL_NC_a16] = &Invoke<&Cpu::ConditionalCall_16bit_ImmediateData, FlagRegisterFlag::CARRY, false>;
+		table[OpCode::PUSH_DE]     = &Invoke<&Cpu::Push<RegisterDE>>;
+		table[OpCode::SUB_A_n8]    = &Invoke<&Cpu::Sub_8bit_ImmediateData>;
+		table[OpCode::RST_10]      = &Invoke<&Cpu::RST, 0x10>;
+		table[OpCode::RET_C]       = &Invoke<&Cpu::ConditionalReturn, FlagRegisterFlag::CARRY, true>;
+		// 0xD9 - RETI
+		//        Implement when interrupts have been handled
+		table[OpCode::JP_C_a16]    = &Invoke<&Cpu::Jump_Conditional_16bit_ImmediateData, FlagRegisterFlag::CARRY, true>;
+		table[OpCode::ILLEGAL_DB]  = &Invoke<&Cpu::HardLock>;
+		table[OpCode::CALL_C_a16]  = &Invoke<&Cpu::ConditionalCall_16bit_ImmediateData, FlagRegisterFlag::CARRY, true>; 
+		table[OpCode::ILLEGAL_DD]  = &Invoke<&Cpu::HardLock>;
+		table[OpCode::SBC_A_n8]    = &Invoke<&Cpu::SubCarry_8bit_ImmediateData>;
+		table[OpCode::RST_18]      = &Invoke<&Cpu::RST, 0x18>;
+
+		// 0xE-
+		table[OpCode::LDH_a8_NI_A] = &Invoke<&Cpu::Store_8bit_8bitImmediateAddr<GetA>>;
+		table[OpCode::POP_HL]      = &Invoke<&Cpu::Pop<RegisterHL>>;
+		table[OpCode::LDH_C_NI_A]  = &Invoke<&Cpu::Store_8bit_8bitAddr<GetC, GetA>>;
+		table[OpCode::ILLEGAL_E3]  = &Invoke<&Cpu::HardLock>;
+		table[OpCode::ILLEGAL_E4]  = &Invoke<&Cpu::HardLock>;
+		table[OpCode::PUSH_HL]     = &Invoke<&Cpu::Push<RegisterHL>>;
+		table[OpCode::AND_A_n8]    = &Invoke<&Cpu::BitwiseAnd_ImmediateData>;
+		table[OpCode::RST_20]      = &Invoke<&Cpu::RST, 0x20>;
+		table[OpCode::ADD_SP_e8]   = &Invoke<&Cpu::Add_16bit_8bitSignedImmediateData<RegisterSP>>;
+		table[OpCode::JP_HL]       = &Invoke<&Cpu::Jump_Addr, RegisterHL>;
+		table[OpCode::LD_a16_NI_A] = &Invoke<&Cpu::Store_8bit_16bitImmediateAddr<GetA>>;
+		table[OpCode::ILLEGAL_EB]  = &Invoke<&Cpu::HardLock>;
+		table[OpCode::ILLEGAL_EC]  = &Invoke<&Cpu::HardLock>;
+		table[OpCode::ILLEGAL_ED]  = &Invoke<&Cpu::HardLock>;
+		table[OpCode::XOR_A_n8]    = &Invoke<&Cpu::BitwiseXor_ImmediateData>;
+		table[OpCode::RST_28]      = &Invoke<&Cpu::RST, 0x28>;
+
+		// 0xF-
+		table[OpCode::LDH_A_a8_NI]     = &Invoke<&Cpu::Load_8bit_8bitImmediateAddr<SetA>>;
+		table[OpCode::POP_AF]          = &Invoke<&Cpu::Pop<RegisterAF>>;
+		table[OpCode::LDH_A_C_NI]      = &Invoke<&Cpu::Load_8bit_8bitAddr<SetA, GetC>>;
+		// TODO: 0xF3 - DI
+		// Implement when interrupts are handled.
+		table[OpCode::ILLEGAL_F4]      = &Invoke<&Cpu::HardLock>;
+		table[OpCode::PUSH_AF]         = &Invoke<&Cpu::Push<RegisterAF>>;
+		table[OpCode::OR_A_n8]         = &Invoke<&Cpu::BitwiseOr_ImmediateData>;
+		table[OpCode::RST_30]          = &Invoke<&Cpu::RST, 0x30>;
+		table[OpCode::LD_HL_SP_INC_e8] = &Invoke<&Cpu::Store_StackPointerPlusSignedImmediateData<RegisterHL>>;
+		table[OpCode::LD_SP_HL]        = &Invoke<&Cpu::Load_16bit<RegisterSP, RegisterHL>>;
+		table[OpCode::LD_A_a16_NI]     = &Invoke<&Cpu::Load_8bit_ImmediateAddr<SetA>>;
+		// TODO: 0xFB - EI
+		// Implement when interrupts are handled.
+		table[OpCode::ILLEGAL_FC]      = &Invoke<&Cpu::HardLock>;
+		table[OpCode::ILLEGAL_FD]      = &Invoke<&Cpu::HardLock>;
+		table[OpCode::CP_A_n8]         = &Invoke<&Cpu::Compare_8bit_ImmediateData>;
+		table[OpCode::RST_38]          = &Invoke<&Cpu::RST, 0x38>;
+
+		return table;
+	}
+
+	template<uint8_t opCode>
+	constexpr Cpu::InstructionPrototype Cpu::MakePrefixedInstruction()
+	{
+		// Prefixed opcodes decode regularly: bits 7-6 select rotate/shift, BIT, RES or SET,
+		// bits 5-3 hold the rotate/shift operation or the bit index and bits 2-0 the operand.
+		constexpr uint8_t operationGroup = opCode >> 6;
+		constexpr uint8_t operation = (opCode >> 3) & 0b111;
+		constexpr uint8_t bitMask = 1 << operation;
+		constexpr uint8_t operand = opCode & 0b111;
+
+		constexpr uint8_t dereferencedHL = 6;
+		constexpr RegisterPointer operandRegisters[] = { RegisterBC, RegisterBC, RegisterDE, RegisterDE, RegisterHL, RegisterHL, RegisterHL, RegisterAF };
+		constexpr RegisterGet8Bit operandGetters[] = {
+			&Register::HighByte, &Register::LowByte, &Register::HighByte, &Register::LowByte,
+			&Register::HighByte, &Register::LowByte, nullptr, &Register::HighByte
+		};
+		constexpr RegisterSet8Bit operandSetters[] = {
+			&Register::SetHighByte, &Register::SetLowByte, &Register::SetHighByte, &Register::SetLowByte,
+			&Register::SetHighByte, &Register::SetLowByte, nullptr, &Register::SetHighByte
+		};
+
+		constexpr RegisterPointer reg = operandRegisters[operand];
+		constexpr RegisterGet8Bit GetValue = operandGetters[operand];
+		constexpr RegisterSet8Bit SetValue = operandSetters[operand];
+
+		// Selects the (HL) dereferencing variant of an implementation for operand 6.
+		#define PREFIXED_INSTRUCTION(Implementation, ...)                                      \
+			if constexpr (operand == dereferencedHL)                                           \
+				return &Invoke<&Cpu::Implementation##_Addr<__VA_ARGS__ RegisterHL>>;           \
+			else                                                                               \
+				return &Invoke<&Cpu::Implementation<__VA_ARGS__ reg, GetValue, SetValue>>;
+
+		if constexpr (operationGroup == 0)
+		{
+			if constexpr (operation == 0)      { PREFIXED_INSTRUCTION(RotateLeftCarry) }
+			else if constexpr (operation == 1) { PREFIXED_INSTRUCTION(RotateRightCarry) }
+			else if constexpr (operation == 2) { PREFIXED_INSTRUCTION(RotateLeft) }
+			else if constexpr (operation == 3) { PREFIXED_INSTRUCTION(RotateRight) }
+			else if constexpr (operation == 4) { PREFIXED_INSTRUCTION(ShiftLeftArithmetic) }
+			else if constexpr (operation == 5) { PREFIXED_INSTRUCTION(ShiftRightArithmetic) }
+			else if constexpr (operation == 6) { PREFIXED_INSTRUCTION(Swap) }
+			else                               { PREFIXED_INSTRUCTION(ShiftRightLogical) }
+		}
+		else if constexpr (operationGroup == 1)
+		{
+			// BIT only reads its operand.
+			if constexpr (operand == dereferencedHL)
+				return &Invoke<&Cpu::BitComplementToZeroFlag_Addr<bitMask, RegisterHL>>;
+			else
+				return &Invoke<&Cpu::BitComplementToZeroFlag<bitMask, reg, GetValue>>;
+		}
+		else if constexpr (operationGroup == 2)
+		{
+			PREFIXED_INSTRUCTION(BitReset, bitMask,)
+		}
+		else
+		{
+			PREFIXED_INSTRUCTION(BitSet, bitMask,)
+		}
+
+		#undef PREFIXED_INSTRUCTION
+	}
+
+	constexpr Cpu::PrefixedInstructionTable Cpu::MakePrefixedInstructionTable()
+	{
+		return []<size_t... opCodes>(std::index_sequence<opCodes...>)
+		{
+			PrefixedInstructionTable preTable{};
+			((preTable[static_cast<PrefixedOpCode>(opCodes)] = MakePrefixedInstruction<opCodes>()), ...);
+			return preTable;
+		}(std::make_index_sequence<numberOfPrefixedInstructions>{});
+	}
+
+	#undef GetSetA
+	#undef GetSetL
+	#undef GetSetH
+	#undef GetSetE
+	#undef GetSetD
+	#undef GetSetC
+	#undef GetSetB
+
+	#undef SetA
+	#undef SetL
+	#undef SetH
+	#undef SetE
+	#undef SetD
+	#undef SetC
+	#undef SetB
+
+	#undef GetA
+	#undef GetL
+	#undef GetH
+	#undef GetE
+	#undef GetD
+	#undef GetC
+	#undef GetB
+
+	#undef RegisterSP
+	#undef RegisterAF
+	#undef RegisterHL
+	#undef RegisterDE
+	#undef RegisterBC
+} // namespace GameBoy
@@ -0,0 +1,302 @@
+// ****************************************************************************** //
+//   _______   __                              __       __                        //
+//  /       \ /  |                            /  \     /  |                       //
+//  $$$$$$$  |$$ |  ______   __    __         $$  \   /$$ |  ______   _______     //
+//  $$ |__$$ |$$ | /      \ /  |  /  | ______ $$$  \ /$$$ | /      \ /       \    //
+//  $$    $$/ $$ | $$$$$$  |$$ |  $$ |/      |$$$$  /$$$$ | $$$$$$  |$$$$$$$  |   //
+//  $$$$$$$/  $$ | /    $$ |$$ |  $$ |$$$$$$/ $$ $$ $$/$$ | /    $$ |$$ |  $$ |   //
+//  $$ |      $$ |/$$$$$$$ |$$ \__$$ |        $$ |$$$/ $$ |/$$$$$$$ |$$ |  $$ |   //
+//  $$ |      $$ |$$    $$ |$$    $$ |        $$ | $/  $$ |$$    $$ |$$ |  $$ |   //
+//  $$/       $$/  $$$$$$$/  $$$$$$$ |        $$/      $$/  $$$$$$$/ $$/   $$/    //
+//                          /  \__$$ |                                            //
+//                          $$    $$/                                             //
+//                           $$$$$$/                                              //
+//                                                                                //
+//                            By: K1ngmar and rvan-mee                            //
+// ****************************************************************************** //
+
+#pragma once
+
+#define HALF_CARRY_BIT 0b1'0000
+#define CARRY_BIT 0b1'0000'0000
+
+namespace GameBoy
+{
+    template<RegisterPointer opReg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+    size_t Cpu::Increment_8bit()
+    {
+        Register& operandRegister = core.*opReg;
+        const uint8_t value = (operandRegister.*GetValue)();
+        const uint8_t result = value + 1;
+
+        (operandRegister.*SetValue)(result);
+
+        core.SetFlagsLazy(LazyFlagOperation::Increment, value, 1, result, core.GetFlag(FlagRegisterFlag::CARRY));
+
+        constexpr size_t numberOfCycles = 1;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer addrReg>
+    size_t Cpu::Increment_Dereferenced()
+    {
+        const auto address = (core.*addrReg).Value();
+        const uint8_t value = memoryBus.ReadByte(address);
+        const uint8_t result = value + 1;
+
+        memoryBus.WriteByte(address, result);
+
+        core.SetFlagsLazy(LazyFlagOperation::Increment, value, 1, result, core.GetFlag(FlagRegisterFlag::CARRY));
+
+        constexpr size_t numberOfCycles = 3;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer opReg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+    size_t Cpu::Decrement_8bit()
+    {
+        Register& operandRegister = core.*opReg;
+        const uint8_t value = (operandRegister.*GetValue)();
+        const uint8_t result = value - 1;
+
+        (operandRegister.*SetValue)(result);
+
+        core.SetFlagsLazy(LazyFlagOperation::Decrement, value, 1, result, core.GetFlag(FlagRegisterFlag::CARRY));
+
+        constexpr size_t numberOfCycles = 1;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer addrReg>
+    size_t Cpu::Decrement_Dereferenced()
+    {
+        const auto address = (core.*addrReg).Value();
+        const uint8_t value = memoryBus.ReadByte(address);
+        const uint8_t result = value - 1;
+
+        memoryBus.WriteByte(address, result);
+
+        core.SetFlagsLazy(LazyFlagOperation::Decrement, value, 1, result, core.GetFlag(FlagRegisterFlag::CARRY));
+
+        constexpr size_t numberOfCycles = 3;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer opReg, RegisterGet8Bit GetValue>
+    size_t Cpu::Compare_8bit()
+    {
+        const uint8_t baseValue = core.AF.HighByte();
+        const uint8_t operand = ((core.*opReg).*GetValue)();
+        const uint8_t compareResult = baseValue - operand;
+
+        core.SetFlagsLazy(LazyFlagOperation::Sub, baseValue, operand, compareResult);
+
+        constexpr size_t numberOfCycles = 1;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer addrReg>
+    size_t Cpu::Compare_8bit_Addr()
+    {
+        const uint16_t address = (core.*addrReg).Value();
+        const uint8_t  baseValue = core.AF.HighByte();
+        const uint8_t  operand = memoryBus.ReadByte(address);
+        const uint8_t  compareResult = baseValue - operand;
+
+        core.SetFlagsLazy(LazyFlagOperation::Sub, baseValue, operand, compareResult);
+
+        constexpr size_t numberOfCycles = 2;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer reg>
+    size_t Cpu::Increment_16bit()
+    {
+        Register& r = core.*reg;
+
+        r++;
+        constexpr size_t numberOfCycles = 2;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer reg>
+    size_t Cpu::Decrement_16bit()
+    {
+        Register& r = core.*reg;
+
+        r--;
+        constexpr size_t numberOfCycles = 2;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer toReg, RegisterPointer fromReg>
+    size_t Cpu::Add_16bit()
+    {
+        Register& to = core.*toReg;
+        const Register& from = core.*fromReg;
+        const uint16_t fromValue = from.Value();
+        const uint16_t toValue = to.Value();
+
+        to.SetValue(fromValue + toValue);
+
+        core.SetFlag(FlagRegisterFlag::SUB, false);
+        core.SetFlag(FlagRegisterFlag::HALF_CARRY, (toValue & 0xFFF) + (fromValue & 0xFFF) > 0xFFF);
+        core.SetFlag(FlagRegisterFlag::CARRY, static_cast<uint32_t>(toValue) + static_cast<uint32_t>(fromValue) > 0xFFFF);
+
+        constexpr size_t numberOfCycles = 2;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer reg>
+    size_t Cpu::Add_16bit_8bitSignedImmediateData()
+    {
+        Register& r = core.*reg;
+        const int8_t operandValue = FetchPcAddress();
+        const uint16_t baseValue = r.Value();
+        const int32_t result = baseValue + operandValue; 
+
+        r.SetValue(static_cast<uint16_t>(result));
+
+        core.SetFlag(FlagRegisterFlag::ZERO, false);
+        core.SetFlag(FlagRegisterFlag::SUB, false);
+        core.SetFlag(FlagRegisterFlag::HALF_CARRY, ((baseValue & 0xF) + (operandValue & 0xF)) & HALF_CARRY_BIT);
+        core.SetFlag(FlagRegisterFlag::CARRY, ((baseValue & 0xFF) + (operandValue & 0xFF)) & CARRY_BIT);
+
+        constexpr size_t numberOfCycles = 4;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer opReg, RegisterGet8Bit GetValue>
+    size_t Cpu::Add_8bit()
+    {
+        const Register& operandRegister = core.*opReg;
+        const uint16_t operandValue = (operandRegister.*GetValue)();
+        const uint16_t baseValue = core.AF.HighByte();
+        const uint16_t result = operandValue + baseValue;
+
+        core.AF.SetHighByte(result);
+
+        core.SetFlagsLazy(LazyFlagOperation::Add, baseValue, operandValue, result);
+
+        constexpr size_t numberOfCycles = 1;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer addrReg>
+    size_t Cpu::Add_8bit_Addr()
+    {
+        const uint16_t addr = (core.*addrReg).Value();
+        const uint16_t operand = memoryBus.ReadByte(addr);
+        const uint16_t baseValue = core.AF.HighByte();
+        const uint16_t result = operand + baseValue;
+
+        core.AF.SetHighByte(result);
+
+        core.SetFlagsLazy(LazyFlagOperation::Add, baseValue, operand, result);
+
+        constexpr size_t numberOfCycles = 2;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer opReg, RegisterGet8Bit GetValue>
+    size_t Cpu::AddCarry_8bit()
+    {
+        const Register& operandRegister = core.*opReg;
+        const uint16_t operand = (operandRegister.*GetValue)();
+        const uint16_t baseValue = core.AF.HighByte();
+        const uint16_t carryValue = 1 * core.GetFlag(FlagRegisterFlag::CARRY);
+        const uint16_t result = operand + baseValue + carryValue;
+
+        core.AF.SetHighByte(result);
+
+        core.SetFlagsLazy(LazyFlagOperation::Add, baseValue, operand, result, carryValue);
+
+        constexpr size_t numberOfCycles = 1;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer addrReg>
+    size_t Cpu::AddCarry_8bit_Addr()
+    {
+        const uint16_t addr = (core.*addrReg).Value();
+        const uint16_t operand = memoryBus.ReadByte(addr);
+        const uint16_t baseValue = core.AF.HighByte();
+        const uint16_t carryValue = 1 * core.GetFlag(FlagRegisterFlag::CARRY);
+        const uint16_t result = operand + baseValue + carryValue;
+
+        core.AF.SetHighByte(result);
+
+        core.SetFlagsLazy(LazyFlagOperation::Add, baseValue, operand, result, carryValue);
+
+        constexpr size_t numberOfCycles = 2;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer opReg, RegisterGet8Bit GetValue>
+    size_t Cpu::Sub_8bit()
+    {
+        const uint16_t operand = ((core.*opReg).*GetValue)();
+        const uint16_t baseValue = core.AF.HighByte();
+        const uint16_t result = baseValue - operand;
+
+        core.AF.SetHighByte(static_cast<uint8_t>(result));
+
+        core.SetFlagsLazy(LazyFlagOperation::Sub, baseValue, operand, result);
+
+        constexpr size_t numberOfCycles = 1;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer addrReg>
+    size_t Cpu::Sub_8bit_Addr()
+    {
+        const uint16_t addr = (core.*addrReg).Value();
+        const uint16_t operand = memoryBus.ReadByte(addr);
+        const uint16_t baseValue = core.AF.HighByte();
+        const uint16_t result = baseValue - operand;
+
+        core.AF.SetHighByte(static_cast<uint8_t>(result));
+
+        core.SetFlagsLazy(LazyFlagOperation::Sub, baseValue, operand, result);
+
+        constexpr size_t numberOfCycles = 2;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer opReg, RegisterGet8Bit GetValue>
+    size_t Cpu::SubCarry_8bit()
+    {
+        const uint16_t carryValue = 1 * core.GetFlag(FlagRegisterFlag::CARRY);
+        const uint16_t operand = ((core.*opReg).*GetValue)();
+        const uint16_t baseValue = core.AF.HighByte();
+        const uint16_t result = baseValue - operand - carryValue;
+
+        core.AF.SetHighByte(static_cast<uint8_t>(result));
+
+        core.SetFlagsLazy(LazyFlagOperation::Sub, baseValue, operand, result, carryValue);
+
+        constexpr size_t numberOfCycles = 1;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer addrReg>
+    size_t Cpu::SubCarry_8bit_Addr()
+    {
+        const uint16_t carryValue = 1 * core.GetFlag(FlagRegisterFlag::CARRY);
+        uint16_t addr = (core.*addrReg).Value();
+        uint16_t fromValue = memoryBus.ReadByte(addr);
+        uint16_t baseValue = core.AF.HighByte();
+        uint16_t result = baseValue - fromValue - carryValue;
+
+        core.AF.SetHighByte(static_cast<uint8_t>(result));
+
+        core.SetFlagsLazy(LazyFlagOperation::Sub, baseValue, fromValue, result, carryValue);
+
+        constexpr size_t numberOfCycles = 2;
+        return numberOfCycles;
+    }
+
+} // namespace GameBoy
+
+#undef HALF_CARRY_BIT
+#undef CARRY_BIT
@@ -1,400 +1,418 @@
-// ****************************************************************************** //
-//   _______   __                              __       __                        //
-//  /       \ /  |                            /  \     /  |                       //
-//  $$$$$$$  |$$ |  ______   __    __         $$  \   /$$ |  ______   _______     //
-//  $$ |__$$ |$$ | /      \ /  |  /  | ______ $$$  \ /$$$ | /      \ /       \    //
-//  $$    $$/ $$ | $$$$$$  |$$ |  $$ |/      |$$$$  /$$$$ | $$$$$$  |$$$$$$$  |   //
-//  $$$$$$$/  $$ | /    $$ |$$ |  $$ |$$$$$$/ $$ $$ $$/$$ | /    $$ |$$ |  $$ |   //
-//  $$ |      $$ |/$$$$$$$ |$$ \__$$ |        $$ |$$$/ $$ |/$$$$$$$ |$$ |  $$ |   //
-//  $$ |      $$ |$$    $$ |$$    $$ |        $$ | $/  $$ |$$    $$ |$$ |  $$ |   //
-//  $$/       $$/  $$$$$$$/  $$$$$$$ |        $$/      $$/  $$$$$$$/ $$/   $$/    //
-//                          /  \__$$ |                                            //
-//                          $$    $$/                                             //
-//                           $$$$$$/                                              //
-//                                                                                //
-//                            By: K1ngmar and rvan-mee                            //
-// ****************************************************************************** //
-
-#include <play-man/gameboy/cpu/Cpu.hpp>
-
-#define HIGH_BIT 0b10000000
-#define LOW_BIT 0b00000001
-#define NO_BIT 0b00000000
-
-namespace GameBoy
-{
-    size_t Cpu::NoPrefixRotateLeft(RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue)
-    {
-        Register& r = core.*reg;
-        const uint8_t value = (r.*GetValue)();
-        const uint8_t appendBit = core.GetFlag(FlagRegisterFlag::CARRY);
-        const uint8_t result = (value << 1) | appendBit;
-        const bool shiftedBit = (value & HIGH_BIT) > 0;
-
-        (r.*SetValue)(result);
-
-        core.SetFlag(FlagRegisterFlag::ZERO, false);
-        core.SetFlag(FlagRegisterFlag::SUB, false);
-        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
-        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
-
-        constexpr size_t numberOfCycles = 1;
-        return numberOfCycles;
-    }
-
-    size_t Cpu::NoPrefixRotateLeftCarry(RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue)
-    {
-        Register& r = core.*reg;
-        const uint8_t value = (r.*GetValue)();
-        const bool shiftedBit = (value & HIGH_BIT) > 0;
-        const uint8_t result = value << 1 | shiftedBit; 
-
-        (r.*SetValue)(result);
-
-        core.SetFlag(FlagRegisterFlag::ZERO, false);
-        core.SetFlag(FlagRegisterFlag::SUB, false);
-        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
-        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
-
-        constexpr size_t numberOfCycles = 1;
-        return numberOfCycles;
-    }
-
-    size_t Cpu::NoPrefixRotateRight(RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue)
-    {
-        Register& r = core.*reg;
-        const uint8_t value = (r.*GetValue)();
-        const bool shiftedBit = (value & LOW_BIT) > 0;
-        const bool carryBit = core.GetFlag(FlagRegisterFlag::CARRY);
-        const uint8_t result = (carryBit << 7) | (value >> 1);
-
-        (r.*SetValue)(result);
-
-        core.SetFlag(FlagRegisterFlag::ZERO, false);
-        core.SetFlag(FlagRegisterFlag::SUB, false);
-        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
-        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
-
-        constexpr size_t numberOfCycles = 1;
-        return numberOfCycles;
-    }
-
-    size_t Cpu::NoPrefixRotateRightCarry(RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue)
-    {
-        Register& r = core.*reg;
-        const uint8_t value = (r.*GetValue)();
-        const bool shiftedBit = (value & LOW_BIT) > 0;
-        const uint8_t result = (shiftedBit << 7) | (value >> 1);
-
-        (r.*SetValue)(result);
-
-        core.SetFlag(FlagRegisterFlag::ZERO, false);
-        core.SetFlag(FlagRegisterFlag::SUB, false);
-        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
-        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
-
-        constexpr size_t numberOfCycles = 1;
-        return numberOfCycles;
-    }
-
-
-
-
-    /**                                     Prefixed Instructions                                     **/
-
-    size_t Cpu::RotateLeft(RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue)
-    {
-        Register& r = core.*reg;
-        const uint8_t value = (r.*GetValue)();
-        const bool shiftedBit = (value & HIGH_BIT) > 0;
-        const uint8_t appendBit = core.GetFlag(FlagRegisterFlag::CARRY);
-        const uint8_t result = value << 1 | appendBit;
-
-        (r.*SetValue)(result);
-
-        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
-        core.SetFlag(FlagRegisterFlag::SUB, false);
-        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
-        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
-
-        constexpr size_t numberOfCycles = 2;
-        return numberOfCycles;
-    }
-
-    size_t Cpu::RotateLeft_Addr(RegisterPointer addrReg)
-    {
-        Register& r = core.*addrReg;
-        const uint16_t address = r.Value();
-        const uint8_t value = memoryBus.ReadByte(address);
-        const bool shiftedBit = (value & HIGH_BIT) > 0;
-        const uint8_t appendBit = core.GetFlag(FlagRegisterFlag::CARRY);
-        const uint8_t result = value << 1 | appendBit;
-
-        memoryBus.WriteByte(address, result);
-
-        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
-        core.SetFlag(FlagRegisterFlag::SUB, false);
-        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
-        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
-
-        constexpr size_t numberOfCycles = 4;
-        return numberOfCycles;
-    }
-
-
-    size_t Cpu::RotateLeftCarry(RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue)
-    {
-        Register& r = core.*reg;
-        const uint8_t value = (r.*GetValue)();
-        const bool shiftedBit = (value & HIGH_BIT) > 0;
-        const uint8_t result = (value << 1) | shiftedBit;
-
-        (r.*SetValue)(result);
-
-        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
-        core.SetFlag(FlagRegisterFlag::SUB, false);
-        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
-        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
-
-        constexpr size_t numberOfCycles = 2;
-        return numberOfCycles;
-    }
-
-    size_t Cpu::RotateLeftCarry_Addr(RegisterPointer addrReg)
-    {
-        Register& r = core.*addrReg;
-        const uint16_t address = r.Value();
-        const uint8_t value = memoryBus.ReadByte(address);
-        const bool shiftedBit = (value & HIGH_BIT) > 0;
-        const uint8_t result = (value << 1) | shiftedBit;
-
-        memoryBus.WriteByte(address, result);
-
-        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
-        core.SetFlag(FlagRegisterFlag::SUB, false);
-        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
-        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
-
-        constexpr size_t numberOfCycles = 4;
-        return numberOfCycles;
-    }
-
-    size_t Cpu::RotateRight(RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue)
-    {
-        Register& r = core.*reg;
-        const uint8_t value = (r.*GetValue)();
-        const bool shiftedBit = (value & LOW_BIT) > 0;
-        const bool carryBit = core.GetFlag(FlagRegisterFlag::CARRY);
-        const uint8_t result = (carryBit << 7) | (value >> 1);
-
-        (r.*SetValue)(result);
-
-        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
-        core.SetFlag(FlagRegisterFlag::SUB, false);
-        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
-        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
-
-        constexpr size_t numberOfCycles = 2;
-        return numberOfCycles;
-    }
-
-    size_t Cpu::RotateRight_Addr(RegisterPointer addrReg)
-    {
-        Register& r = core.*addrReg;
-        const uint16_t address = r.Value();
-        const uint8_t value = memoryBus.ReadByte(address);
-        const bool shiftedBit = (value & LOW_BIT) > 0;
-        const bool carryBit = core.GetFlag(FlagRegisterFlag::CARRY);
-        const uint8_t result = (carryBit << 7) | (value >> 1);
-
-        memoryBus.WriteByte(address, result);
-
-        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
-        core.SetFlag(FlagRegisterFlag::SUB, false);
-        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
-        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
-
-        constexpr size_t numberOfCycles = 4;
-        return numberOfCycles;
-    }
-
-    size_t Cpu::RotateRightCarry(RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue)
-    {
-        Register& r = core.*reg;
-        const uint8_t value = (r.*GetValue)();
-        const bool shiftedBit = (value & LOW_BIT) > 0;
-        const uint8_t result = (shiftedBit << 7) | (value >> 1);
-
-        (r.*SetValue)(result);
-
-        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
-        core.SetFlag(FlagRegisterFlag::SUB, false);
-        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
-        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
-
-        constexpr size_t numberOfCycles = 2;
-        return numberOfCycles;
-    }
-
-    size_t Cpu::RotateRightCarry_Addr(RegisterPointer addrReg)
-    {
-        Register& r = core.*addrReg;
-        const uint16_t address = r.Value();
-        const uint8_t value = memoryBus.ReadByte(address);
-        const bool shiftedBit = (value & LOW_BIT) > 0;
-        const uint8_t result = (shiftedBit << 7) | (value >> 1);
-
-        memoryBus.WriteByte(address, result);
-
-        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
-        core.SetFlag(FlagRegisterFlag::SUB, false);
-        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
-        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
-
-        constexpr size_t numberOfCycles = 4;
-        return numberOfCycles;
-    }
-
-
-    size_t Cpu::ShiftLeftArithmetic(RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue)
-    {
-        Register& r = core.*reg;
-        const uint8_t value = (r.*GetValue)();
-        const bool shiftedBit = (value & HIGH_BIT);
-        const uint8_t result = value << 1;
-
-        (r.*SetValue)(result);
-
-        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
-        core.SetFlag(FlagRegisterFlag::SUB, false);
-        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
-        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
-
-        constexpr size_t numberOfCycles = 2;
-        return numberOfCycles;
-    }
-
-    size_t Cpu::ShiftLeftArithmetic_Addr(RegisterPointer addrReg)
-    {
-        const uint16_t address = (core.*addrReg).Value();
-        const uint8_t value = memoryBus.ReadByte(address);
-        const bool shiftedBit = (value & HIGH_BIT);
-        const uint8_t result = value << 1;
-
-        memoryBus.WriteByte(address, result);
-
-        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
-        core.SetFlag(FlagRegisterFlag::SUB, false);
-        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
-        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
-
-        constexpr size_t numberOfCycles = 4;
-        return numberOfCycles;
-    }
-
-    size_t Cpu::ShiftRightArithmetic(RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue)
-    {
-        Register& r = core.*reg;
-        const uint8_t value = (r.*GetValue)();
-        const bool shiftedBit = (value & LOW_BIT);
-        const uint8_t result = (value >> 1) | (value & HIGH_BIT);
-
-        (r.*SetValue)(result);
-
-        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
-        core.SetFlag(FlagRegisterFlag::SUB, false);
-        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
-        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
-
-        constexpr size_t numberOfCycles = 2;
-        return numberOfCycles;
-    }
-
-    size_t Cpu::ShiftRightArithmetic_Addr(RegisterPointer addrReg)
-    {
-        const uint16_t address = (core.*addrReg).Value();
-        const uint8_t value = memoryBus.ReadByte(address);
-        const bool shiftedBit = (value & LOW_BIT);
-        const uint8_t result = (value >> 1) | (value & HIGH_BIT);
-
-        memoryBus.WriteByte(address, result);
-
-        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
-        core.SetFlag(FlagRegisterFlag::SUB, false);
-        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
-        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
-
-        constexpr size_t numberOfCycles = 4;
-        return numberOfCycles;
-    }
-
-    size_t Cpu::ShiftRightLogical(RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue)
-    {
-        Register& r = core.*reg;
-        const uint8_t value = (r.*GetValue)();
-        const bool shiftedBit = (value & LOW_BIT);
-        const uint8_t result = value >> 1;
-
-        (r.*SetValue)(result);
-
-        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
-        core.SetFlag(FlagRegisterFlag::SUB, false);
-        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
-        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
-
-        constexpr size_t numberOfCycles = 2;
-        return numberOfCycles;
-    }
-
-    size_t Cpu::ShiftRightLogical_Addr(RegisterPointer addrReg)
-    {
-        const uint16_t address = (core.*addrReg).Value();
-        const uint8_t value = memoryBus.ReadByte(address);
-        const bool shiftedBit = (value & LOW_BIT);
-        const uint8_t result = value >> 1;
-
-        memoryBus.WriteByte(address, result);
-
-        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
-        core.SetFlag(FlagRegisterFlag::SUB, false);
-        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
-        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
-
-        constexpr size_t numberOfCycles = 4;
-        return numberOfCycles;
-    }
-
-    size_t Cpu::Swap(RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue)
-    {
-        Register& r = core.*reg;
-        const uint8_t value = (r.*GetValue)();
-        const uint8_t result = (value << 4) | (value >> 4);
-
-        (r.*SetValue)(result);
-
-        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
-        core.SetFlag(FlagRegisterFlag::SUB, false);
-        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
-        core.SetFlag(FlagRegisterFlag::CARRY, false);
-
-        constexpr size_t numberOfCycles = 2;
-        return numberOfCycles;
-    }
-
-    size_t Cpu::Swap_Addr(RegisterPointer addrReg)
-    {
-        const uint16_t address = (core.*addrReg).Value();
-        const uint8_t value = memoryBus.ReadByte(address);
-        const uint8_t result = (value << 4) | (value >> 4);
-
-        memoryBus.WriteByte(address, result);
-
-        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
-        core.SetFlag(FlagRegisterFlag::SUB, false);
-        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
-        core.SetFlag(FlagRegisterFlag::CARRY, false);
-
-        constexpr size_t numberOfCycles = 4;
-        return numberOfCycles;
-    }
-}
+// ****************************************************************************** //
+//   _______   __                              __       __                        //
+//  /       \ /  |                            /  \     /  |                       //
+//  $$$$$$$  |$$ |  ______   __    __         $$  \   /$$ |  ______   _______     //
+//  $$ |__$$ |$$ | /      \ /  |  /  | ______ $$$  \ /$$$ | /      \ /       \    //
+//  $$    $$/ $$ | $$$$$$  |$$ |  $$ |/      |$$$$  /$$$$ | $$$$$$  |$$$$$$$  |   //
+//  $$$$$$$/  $$ | /    $$ |$$ |  $$ |$$$$$$/ $$ $$ $$/$$ | /    $$ |$$ |  $$ |   //
+//  $$ |      $$ |/$$$$$$$ |$$ \__$$ |        $$ |$$$/ $$ |/$$$$$$$ |$$ |  $$ |   //
+//  $$ |      $$ |$$    $$ |$$    $$ |        $$ | $/  $$ |$$    $$ |$$ |  $$ |   //
+//  $$/       $$/  $$$$$$$/  $$$$$$$ |        $$/      $$/  $$$$$$$/ $$/   $$/    //
+//                          /  \__$$ |                                            //
+//                          $$    $$/                                             //
+//                           $$$$$$/                                              //
+//                                                                                //
+//                            By: K1ngmar and rvan-mee                            //
+// ****************************************************************************** //
+
+#pragma once
+
+#define HIGH_BIT 0b10000000
+#define LOW_BIT 0b00000001
+
+namespace GameBoy
+{
+    template<RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+    size_t Cpu::NoPrefixRotateLeft()
+    {
+        Register& r = core.*reg;
+        const uint8_t value = (r.*GetValue)();
+        const uint8_t appendBit = core.GetFlag(FlagRegisterFlag::CARRY);
+        const uint8_t result = (value << 1) | appendBit;
+        const bool shiftedBit = (value & HIGH_BIT) > 0;
+
+        (r.*SetValue)(result);
+
+        core.SetFlag(FlagRegisterFlag::ZERO, false);
+        core.SetFlag(FlagRegisterFlag::SUB, false);
+        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
+        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
+
+        constexpr size_t numberOfCycles = 1;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+    size_t Cpu::NoPrefixRotateLeftCarry()
+    {
+        Register& r = core.*reg;
+        const uint8_t value = (r.*GetValue)();
+        const bool shiftedBit = (value & HIGH_BIT) > 0;
+        const uint8_t result = value << 1 | shiftedBit; 
+
+        (r.*SetValue)(result);
+
+        core.SetFlag(FlagRegisterFlag::ZERO, false);
+        core.SetFlag(FlagRegisterFlag::SUB, false);
+        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
+        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
+
+        constexpr size_t numberOfCycles = 1;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+    size_t Cpu::NoPrefixRotateRight()
+    {
+        Register& r = core.*reg;
+        const uint8_t value = (r.*GetValue)();
+        const bool shiftedBit = (value & LOW_BIT) > 0;
+        const bool carryBit = core.GetFlag(FlagRegisterFlag::CARRY);
+        const uint8_t result = (carryBit << 7) | (value >> 1);
+
+        (r.*SetValue)(result);
+
+        core.SetFlag(FlagRegisterFlag::ZERO, false);
+        core.SetFlag(FlagRegisterFlag::SUB, false);
+        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
+        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
+
+        constexpr size_t numberOfCycles = 1;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+    size_t Cpu::NoPrefixRotateRightCarry()
+    {
+        Register& r = core.*reg;
+        const uint8_t value = (r.*GetValue)();
+        const bool shiftedBit = (value & LOW_BIT) > 0;
+        const uint8_t result = (shiftedBit << 7) | (value >> 1);
+
+        (r.*SetValue)(result);
+
+        core.SetFlag(FlagRegisterFlag::ZERO, false);
+        core.SetFlag(FlagRegisterFlag::SUB, false);
+        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
+        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
+
+        constexpr size_t numberOfCycles = 1;
+        return numberOfCycles;
+    }
+
+    /**                                     Prefixed Instructions                                     **/
+
+    template<RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+    size_t Cpu::RotateLeft()
+    {
+        Register& r = core.*reg;
+        const uint8_t value = (r.*GetValue)();
+        const bool shiftedBit = (value & HIGH_BIT) > 0;
+        const uint8_t appendBit = core.GetFlag(FlagRegisterFlag::CARRY);
+        const uint8_t result = value << 1 | appendBit;
+
+        (r.*SetValue)(result);
+
+        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
+        core.SetFlag(FlagRegisterFlag::SUB, false);
+        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
+        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
+
+        constexpr size_t numberOfCycles = 2;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer addrReg>
+    size_t Cpu::RotateLeft_Addr()
+    {
+        Register& r = core.*addrReg;
+        const uint16_t address = r.Value();
+        const uint8_t value = memoryBus.ReadByte(address);
+        const bool shiftedBit = (value & HIGH_BIT) > 0;
+        const uint8_t appendBit = core.GetFlag(FlagRegisterFlag::CARRY);
+        const uint8_t result = value << 1 | appendBit;
+
+        memoryBus.WriteByte(address, result);
+
+        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
+        core.SetFlag(FlagRegisterFlag::SUB, false);
+        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
+        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
+
+        constexpr size_t numberOfCycles = 4;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+    size_t Cpu::RotateLeftCarry()
+    {
+        Register& r = core.*reg;
+        const uint8_t value = (r.*GetValue)();
+        const bool shiftedBit = (value & HIGH_BIT) > 0;
+        const uint8_t result = (value << 1) | shiftedBit;
+
+        (r.*SetValue)(result);
+
+        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
+        core.SetFlag(FlagRegisterFlag::SUB, false);
+        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
+        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
+
+        constexpr size_t numberOfCycles = 2;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer addrReg>
+    size_t Cpu::RotateLeftCarry_Addr()
+    {
+        Register& r = core.*addrReg;
+        const uint16_t address = r.Value();
+        const uint8_t value = memoryBus.ReadByte(address);
+        const bool shiftedBit = (value & HIGH_BIT) > 0;
+        const uint8_t result = (value << 1) | shiftedBit;
+
+        memoryBus.WriteByte(address, result);
+
+        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
+        core.SetFlag(FlagRegisterFlag::SUB, false);
+        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
+        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
+
+        constexpr size_t numberOfCycles = 4;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+    size_t Cpu::RotateRight()
+    {
+        Register& r = core.*reg;
+        const uint8_t value = (r.*GetValue)();
+        const bool shiftedBit = (value & LOW_BIT) > 0;
+        const bool carryBit = core.GetFlag(FlagRegisterFlag::CARRY);
+        const uint8_t result = (carryBit << 7) | (value >> 1);
+
+        (r.*SetValue)(result);
+
+        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
+        core.SetFlag(FlagRegisterFlag::SUB, false);
+        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
+        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
+
+        constexpr size_t numberOfCycles = 2;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer addrReg>
+    size_t Cpu::RotateRight_Addr()
+    {
+        Register& r = core.*addrReg;
+        const uint16_t address = r.Value();
+        const uint8_t value = memoryBus.ReadByte(address);
+        const bool shiftedBit = (value & LOW_BIT) > 0;
+        const bool carryBit = core.GetFlag(FlagRegisterFlag::CARRY);
+        const uint8_t result = (carryBit << 7) | (value >> 1);
+
+        memoryBus.WriteByte(address, result);
+
+        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
+        core.SetFlag(FlagRegisterFlag::SUB, false);
+        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
+        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
+
+        constexpr size_t numberOfCycles = 4;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+    size_t Cpu::RotateRightCarry()
+    {
+        Register& r = core.*reg;
+        const uint8_t value = (r.*GetValue)();
+        const bool shiftedBit = (value & LOW_BIT) > 0;
+        const uint8_t result = (shiftedBit << 7) | (value >> 1);
+
+        (r.*SetValue)(result);
+
+        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
+        core.SetFlag(FlagRegisterFlag::SUB, false);
+        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
+        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
+
+        constexpr size_t numberOfCycles = 2;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer addrReg>
+    size_t Cpu::RotateRightCarry_Addr()
+    {
+        Register& r = core.*addrReg;
+        const uint16_t address = r.Value();
+        const uint8_t value = memoryBus.ReadByte(address);
+        const bool shiftedBit = (value & LOW_BIT) > 0;
+        const uint8_t result = (shiftedBit << 7) | (value >> 1);
+
+        memoryBus.WriteByte(address, result);
+
+        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
+        core.SetFlag(FlagRegisterFlag::SUB, false);
+        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
+        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
+
+        constexpr size_t numberOfCycles = 4;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+    size_t Cpu::ShiftLeftArithmetic()
+    {
+        Register& r = core.*reg;
+        const uint8_t value = (r.*GetValue)();
+        const bool shiftedBit = (value & HIGH_BIT);
+        const uint8_t result = value << 1;
+
+        (r.*SetValue)(result);
+
+        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
+        core.SetFlag(FlagRegisterFlag::SUB, false);
+        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
+        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
+
+        constexpr size_t numberOfCycles = 2;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer addrReg>
+    size_t Cpu::ShiftLeftArithmetic_Addr()
+    {
+        const uint16_t address = (core.*addrReg).Value();
+        const uint8_t value = memoryBus.ReadByte(address);
+        const bool shiftedBit = (value & HIGH_BIT);
+        const uint8_t result = value << 1;
+
+        memoryBus.WriteByte(address, result);
+
+        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
+        core.SetFlag(FlagRegisterFlag::SUB, false);
+        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
+        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
+
+        constexpr size_t numberOfCycles = 4;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+    size_t Cpu::ShiftRightArithmetic()
+    {
+        Register& r = core.*reg;
+        const uint8_t value = (r.*GetValue)();
+        const bool shiftedBit = (value & LOW_BIT);
+        const uint8_t result = (value >> 1) | (value & HIGH_BIT);
+
+        (r.*SetValue)(result);
+
+        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
+        core.SetFlag(FlagRegisterFlag::SUB, false);
+        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
+        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
+
+        constexpr size_t numberOfCycles = 2;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer addrReg>
+    size_t Cpu::ShiftRightArithmetic_Addr()
+    {
+        const uint16_t address = (core.*addrReg).Value();
+        const uint8_t value = memoryBus.ReadByte(address);
+        const bool shiftedBit = (value & LOW_BIT);
+        const uint8_t result = (value >> 1) | (value & HIGH_BIT);
+
+        memoryBus.WriteByte(address, result);
+
+        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
+        core.SetFlag(FlagRegisterFlag::SUB, false);
+        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
+        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
+
+        constexpr size_t numberOfCycles = 4;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+    size_t Cpu::ShiftRightLogical()
+    {
+        Register& r = core.*reg;
+        const uint8_t value = (r.*GetValue)();
+        const bool shiftedBit = (value & LOW_BIT);
+        const uint8_t result = value >> 1;
+
+        (r.*SetValue)(result);
+
+        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
+        core.SetFlag(FlagRegisterFlag::SUB, false);
+        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
+        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
+
+        constexpr size_t numberOfCycles = 2;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer addrReg>
+    size_t Cpu::ShiftRightLogical_Addr()
+    {
+        const uint16_t address = (core.*addrReg).Value();
+        const uint8_t value = memoryBus.ReadByte(address);
+        const bool shiftedBit = (value & LOW_BIT);
+        const uint8_t result = value >> 1;
+
+        memoryBus.WriteByte(address, result);
+
+        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
+        core.SetFlag(FlagRegisterFlag::SUB, false);
+        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
+        core.SetFlag(FlagRegisterFlag::CARRY, shiftedBit);
+
+        constexpr size_t numberOfCycles = 4;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer reg, RegisterGet8Bit GetValue, RegisterSet8Bit SetValue>
+    size_t Cpu::Swap()
+    {
+        Register& r = core.*reg;
+        const uint8_t value = (r.*GetValue)();
+        const uint8_t result = (value << 4) | (value >> 4);
+
+        (r.*SetValue)(result);
+
+        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
+        core.SetFlag(FlagRegisterFlag::SUB, false);
+        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
+        core.SetFlag(FlagRegisterFlag::CARRY, false);
+
+        constexpr size_t numberOfCycles = 2;
+        return numberOfCycles;
+    }
+
+    template<RegisterPointer addrReg>
+    size_t Cpu::Swap_Addr()
+    {
+        const uint16_t address = (core.*addrReg).Value();
+        const uint8_t value = memoryBus.ReadByte(address);
+        const uint8_t result = (value << 4) | (value >> 4);
+
+        memoryBus.WriteByte(address, result);
+
+        core.SetFlag(FlagRegisterFlag::ZERO, result == 0);
+        core.SetFlag(FlagRegisterFlag::SUB, false);
+        core.SetFlag(FlagRegisterFlag::HALF_CARRY, false);
+        core.SetFlag(FlagRegisterFlag::CARRY, false);
+
+        constexpr size_t numberOfCycles = 4;
+        return numberOfCycles;
+    }
+
+} // namespace GameBoy
+
+#undef HIGH_BIT
+#undef LOW_BIT
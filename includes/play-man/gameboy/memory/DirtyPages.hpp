@@ -0,0 +1,127 @@
+// ****************************************************************************** //
+//   _______   __                              __       __                        //
+//  /       \ /  |                            /  \     /  |                       //
+//  $$$$$$$  |$$ |  ______   __    __         $$  \   /$$ |  ______   _______     //
+//  $$ |__$$ |$$ | /      \ /  |  /  | ______ $$$  \ /$$$ | /      \ /       \    //
+//  $$    $$/ $$ | $$$$$$  |$$ |  $$ |/      |$$$$  /$$$$ | $$$$$$  |$$$$$$$  |   //
+//  $$$$$$$/  $$ | /    $$ |$$ |  $$ |$$$$$$/ $$ $$ $$/$$ | /    $$ |$$ |  $$ |   //
+//  $$ |      $$ |/$$$$$$$ |$$ \__$$ |        $$ |$$$/ $$ |/$$$$$$$ |$$ |  $$ |   //
+//  $$ |      $$ |$$    $$ |$$    $$ |        $$ | $/  $$ |$$    $$ |$$ |  $$ |   //
+//  $$/       $$/  $$$$$$$/  $$$$$$$ |        $$/      $$/  $$$$$$$/ $$/   $$/    //
+//                          /  \__$$ |                                            //
+//                          $$    $$/                                             //
+//                           $$$$$$/                                              //
+//                                                                                //
+//                            By: K1ngmar and rvan-mee                            //
+// ****************************************************************************** //
+
+#pragma once
+
+#include <play-man/gameboy/memory/MemoryDefines.hpp>
+#include <algorithm>
+#include <bit>
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace GameBoy {
+
+    /**
+     * @brief Bitmap of the memoryPageSize byte pages of a block of memory that were written since
+     * the bitmap was last cleared, so consumers like save states only have to process what changed.
+     */
+    class DirtyPages
+    {
+    private:
+        static constexpr uint32_t pagesPerWord = 64;
+
+        std::vector<uint64_t>   words;
+        size_t                  pageCount = 0;
+
+    public:
+        /**
+         * @brief The bit of a single page, lets a page table mark the page with a single OR.
+         */
+        struct Marker
+        {
+            uint64_t*   word = nullptr;
+            uint64_t    bit = 0;
+
+            void Mark() const { *word |= bit; }
+        };
+
+        DirtyPages() = default;
+
+        /**
+         * @brief Tracks sizeInBytes bytes of memory, all pages start out clean.
+         */
+        DirtyPages(size_t sizeInBytes)
+            : words((sizeInBytes / memoryPageSize + pagesPerWord - 1) / pagesPerWord), pageCount(sizeInBytes / memoryPageSize) {};
+
+        /**
+         * @return The amount of pages tracked.
+         */
+        size_t PageCount() const { return pageCount; }
+
+        /**
+         * @brief Marks the page containing the byte at the given offset.
+         */
+        void Mark(size_t offset)
+        {
+            const size_t page = offset >> memoryPageShift;
+            words[page / pagesPerWord] |= uint64_t(1) << (page % pagesPerWord);
+        }
+
+        /**
+         * @brief Returns the marker of the page containing the byte at the given offset.
+         * 
+         * @note The marker stays valid for the lifetime of the bitmap, it is not invalidated by Clear.
+         */
+        Marker GetMarker(size_t offset)
+        {
+            const size_t page = offset >> memoryPageShift;
+            return Marker { &words[page / pagesPerWord], uint64_t(1) << (page % pagesPerWord) };
+        }
+
+        void MarkAll()
+        {
+            std::fill(words.begin(), words.end(), ~uint64_t(0));
+            if (pageCount % pagesPerWord != 0)
+                words.back() = (uint64_t(1) << (pageCount % pagesPerWord)) - 1;
+        }
+
+        void Clear()
+        {
+            std::fill(words.begin(), words.end(), 0);
+        }
+
+        bool IsDirty(size_t page) const
+        {
+            return (words[page / pagesPerWord] >> (page % pagesPerWord)) & 1;
+        }
+
+        /**
+         * @return Whether any page has been written since the last Clear.
+         */
+        bool Any() const
+        {
+            return std::any_of(words.begin(), words.end(), [](uint64_t word) { return word != 0; });
+        }
+
+        /**
+         * @brief Calls function with the index of every dirty page, in ascending order.
+         */
+        template <typename Function>
+        void ForEachDirtyPage(Function&& function) const
+        {
+            for (size_t index = 0; index < words.size(); index++)
+            {
+                for (uint64_t word = words[index]; word != 0; word &= word - 1)
+                {
+                    function(index * pagesPerWord + std::countr_zero(word));
+                }
+            }
+        }
+    };
+
+}
@@ -21,14 +21,19 @@
 #include <play-man/gameboy/cpu/CpuCore.hpp>
 #include <play-man/gameboy/cartridge/Cartridge.hpp>
 #include <play-man/gameboy/memory/MemoryDefines.hpp>
+#include <play-man/gameboy/memory/DirtyPages.hpp>
+#include <play-man/gameboy/timer/Timer.hpp>
 #include <stdint.h>
+#include <utility>
 
 namespace GameBoy {
 
     class MemoryBus {
         private:
             std::shared_ptr<ACartridge> cartridge;
+            CartridgeMapper             mapper; /*!< The cartridge's concrete mapper, the slow path calls it without virtual dispatch. */
             CpuCore&                    core;
+            Timer&                      timer;
             // TODO:
             // video module
             // io module
@@ -36,9 +41,148 @@ namespace GameBoy {
 
             std::array<WorkRamBank, 8> workRam;
 
+            /**
+             * @brief The work RAM bank mapped at 0xD000-0xDFFF in CGB mode, selected through SVBK.
+             */
+            uint8_t workRamBank = 1;
+
+            /**
+             * @brief Host pointers to the start of every memory page, nullptr means
+             * the page has to be handled by the slow path.
+             * 
+             * @note Has to be kept up to date whenever the mapping changes, e.g. on bank switches.
+             */
+            std::array<const uint8_t*, memoryPageCount> readPages {};
+            std::array<uint8_t*, memoryPageCount>       writePages {};
+
+            /**
+             * @brief The dirty page marker of every writable page, so a store through the page table
+             * only has to OR a single bit into the bitmap of the memory it writes to.
+             * 
+             * @note Only valid for the pages with a write pointer.
+             */
+            std::array<DirtyPages::Marker, memoryPageCount> dirtyMarkers {};
+
+            /**
+             * @brief The pages of workRam written since the consumer last cleared them, indexed by
+             * their offset into workRam.
+             */
+            DirtyPages      workRamDirtyPages { sizeof(workRam) };
+
+            /**
+             * @brief The page instructions are currently fetched from, only refreshed when
+             * the fetch address leaves the page or the page table changes.
+             * 
+             * @note fetchPageIndex is set to memoryPageCount to invalidate the cached page.
+             */
+            const uint8_t*  fetchPage = nullptr;
+            uint32_t        fetchPageIndex = memoryPageCount;
+
+            /**
+             * @brief Writable pages that contain decoded code, their writes are routed through the
+             * slow path so the decoded blocks can be invalidated.
+             * 
+             * @note codeWritePages holds the write pointers that were unmapped to protect the pages.
+             */
+            std::array<bool, memoryPageCount>       codePages {};
+            std::array<uint8_t*, memoryPageCount>   codeWritePages {};
+
+            /**
+             * @brief Incremented whenever the page table changes or protected code gets written.
+             */
+            uint32_t        codeGeneration = 0;
+
+            /**
+             * @brief Incremented whenever blocks decoded from writable memory become invalid: writable pages got
+             * remapped or protected code got written. Remapping only ROM pages leaves it as is.
+             */
+            uint32_t        writableCodeGeneration = 0;
+
+            /**
+             * @brief Whether the page tables map memory at all, while disabled every access goes
+             * through the slow path, see SetPageTablesEnabled.
+             */
+            bool            pageTablesEnabled = true;
+
+            /**
+             * @brief Advanced by a machine cycle on every access through the slow path, nullptr when
+             * accesses are not timed.
+             * 
+             * @note accessCycles counts the cycles it has been advanced by since TakeAccessCycles.
+             */
+            size_t*         accessClock = nullptr;
+            size_t          accessCycles = 0;
+
+            /**
+             * @brief Advances the access clock, if any, by the machine cycle of a single access.
+             */
+            void TimeAccess()
+            {
+                if (accessClock != nullptr)
+                {
+                    ++*accessClock;
+                    accessCycles++;
+                }
+            }
+
+            /**
+             * @brief Maps a single page, the dirty marker is only used when write is set.
+             * @return Whether the page was mapped to different memory before.
+             */
+            bool MapPage(const uint8_t page, const uint8_t* read, uint8_t* write, DirtyPages::Marker dirtyMarker);
+
+            /**
+             * @brief Maps the pages in the range [start, end] to the given memory.
+             * 
+             * @param dirtyPages The bitmap tracking writes to the memory, write is found at dirtyOffset in it.
+             * @return Whether any of the pages was mapped to different memory before.
+             */
+            bool MapPages(const uint16_t start, const uint16_t end, const uint8_t* read, uint8_t* write,
+                          DirtyPages& dirtyPages, const size_t dirtyOffset);
+
+            /**
+             * @brief Has to be called once the mapping changed, the fetched page and decoded blocks
+             * might refer to memory that is no longer mapped.
+             * 
+             * @param writableChanged Whether writable memory got remapped, which invalidates the blocks
+             * decoded from writable memory. Blocks decoded from ROM stay valid, they are found by their host memory.
+             */
+            void MappingChanged(const bool writableChanged);
+
+            /**
+             * @brief Restores the write pointers of all pages protected by ProtectCodePage.
+             */
+            void UnprotectCodePages();
+
+            /**
+             * @brief Maps the work RAM pages, including the switchable bank.
+             */
+            void MapWorkRam();
+
+            /**
+             * @brief Writes a byte of work RAM bank without going through the page table.
+             */
+            void WriteWorkRam(const uint8_t bank, const uint16_t offset, const uint8_t value)
+            {
+                workRam[bank][offset] = value;
+                workRamDirtyPages.Mark(bank * sizeof(WorkRamBank) + offset);
+            }
+
+            /**
+             * @brief Decodes addresses that are not mapped in the page table.
+             */
+            uint8_t ReadByteSlow(const uint16_t address);
+            void    WriteByteSlow(const uint16_t address, const uint8_t value);
+
+            /**
+             * @brief Accesses the cartridge through its concrete mapper.
+             */
+            uint8_t ReadCartridge(const uint16_t address);
+            void    WriteCartridge(const uint16_t address, const uint8_t value);
+
         public:
             MemoryBus() = delete;
-            MemoryBus(std::shared_ptr<ACartridge> _cartridge, CpuCore& _core) : cartridge(_cartridge), core(_core) {};
+            MemoryBus(std::shared_ptr<ACartridge> _cartridge, CpuCore& _core, Timer& _timer);
 
             /**
              * @brief Passthrough function to call the regular Readbyte,
@@ -70,6 +214,13 @@ namespace GameBoy {
              * @param value The value to be set.
              */
             void WriteByte(const uint16_t address, const uint8_t value);
+
+            /**
+             * @brief Same as ReadByte but reads through the cached fetch page,
+             * meant for sequential reads such as opcodes and immediate data.
+             * @param address The address to fetch the data from.
+             */
+            uint8_t FetchByte(const uint16_t address);
              
             /**
              * @brief Pops 2 bytes from the address pointed to by SP, which then
@@ -87,6 +238,173 @@ namespace GameBoy {
              */
             void PushStack(uint16_t value);
 
+            /**
+             * @brief Requeries the cartridge for the memory mapped at the ROM and external RAM pages.
+             * 
+             * @note Called after every write to the cartridge's control registers,
+             * only needs to be called manually when the cartridge's data gets replaced.
+             * Pages that stay mapped to the same memory are left alone, so a write that does not switch
+             * banks (e.g. enabling the RAM or selecting the current bank again) costs nothing.
+             */
+            void MapCartridge();
+
+            /**
+             * @brief Selects the work RAM bank mapped at 0xD000-0xDFFF (SVBK), only has effect in CGB mode.
+             * @param value The bank number, bank 0 selects bank 1.
+             */
+            void SetWorkRamBank(const uint8_t value);
+
+            /**
+             * @brief Returns the host memory mapped at the given page, nullptr if the page is not directly mapped.
+             */
+            const uint8_t* GetReadPage(const uint8_t page) const
+            {
+                return readPages[page];
+            }
+
+            /**
+             * @brief Routes the writes to a writable page through the slow path, until either the page
+             * gets written or the page table changes. Both increment the code generation.
+             * 
+             * @param page The page containing decoded code.
+             * 
+             * @return Whether code read from the page stays valid until the code generation changes,
+             * false for pages whose memory can change without passing through the page table.
+             */
+            bool ProtectCodePage(const uint8_t page);
+
+            /**
+             * @brief Enables or disables the page tables, disabling them routes every access through the
+             * slow path, which is needed to time the accesses (see SetAccessClock).
+             */
+            void SetPageTablesEnabled(const bool enabled);
+
+            /**
+             * @brief Makes every access through the slow path advance clock by a machine cycle,
+             * nullptr stops timing the accesses.
+             * 
+             * @note Only accesses through the slow path are timed, see SetPageTablesEnabled.
+             */
+            void SetAccessClock(size_t* clock)
+            {
+                accessClock = clock;
+                accessCycles = 0;
+            }
+
+            /**
+             * @brief Returns the amount of cycles the access clock has been advanced by since the last call.
+             */
+            size_t TakeAccessCycles()
+            {
+                return std::exchange(accessCycles, 0);
+            }
+
+            /**
+             * @brief Returns the amount of cycles the access clock has been advanced by since TakeAccessCycles.
+             */
+            size_t AccessCycles() const
+            {
+                return accessCycles;
+            }
+
+            /**
+             * @brief The pages of the work RAM banks written since they were last cleared,
+             * page n covers bank n / 16. See the cartridge's GetRamDirtyPages for the external RAM.
+             * 
+             * @note VRAM is not tracked, the bus does not implement VRAM yet.
+             */
+            DirtyPages& GetWorkRamDirtyPages()
+            {
+                return workRamDirtyPages;
+            }
+
+            /**
+             * @brief Writes the work RAM and its selected bank, the cartridge saves its own state.
+             */
+            void SaveState(SaveStateWriter& writer) const;
+
+            /**
+             * @brief Loads the work RAM, marking all of it dirty, and remaps it.
+             * 
+             * @note Does not remap the cartridge, call MapCartridge once its state is loaded as well.
+             * Invalidates the code decoded from writable memory, including the cartridge RAM.
+             */
+            void LoadState(SaveStateReader& reader) noexcept(false);
+
+            /**
+             * @brief Reads past the section LoadState would read, checking it without loading anything.
+             */
+            void ValidateState(SaveStateReader& reader) const noexcept(false);
+
+            /**
+             * @brief Changes whenever previously read code might have been modified or mapped out.
+             */
+            uint32_t CodeGeneration() const
+            {
+                return codeGeneration;
+            }
+
+            /**
+             * @brief Changes whenever code decoded from writable memory might have been modified or mapped out.
+             */
+            uint32_t WritableCodeGeneration() const
+            {
+                return writableCodeGeneration;
+            }
+
+            /**
+             * @brief The address of the code generation, for generated code that polls it.
+             */
+            const uint32_t* CodeGenerationAddress() const
+            {
+                return &codeGeneration;
+            }
+
     };
 
+    inline uint8_t MemoryBus::ReadByte(const uint16_t address)
+    {
+        const uint8_t* page = readPages[address >> memoryPageShift];
+
+        if (page != nullptr) [[likely]]
+            return page[address & memoryPageMask];
+        return ReadByteSlow(address);
+    }
+
+    inline uint8_t MemoryBus::FetchByte(const uint16_t address)
+    {
+        if ((address >> memoryPageShift) != fetchPageIndex) [[unlikely]]
+        {
+            fetchPageIndex = address >> memoryPageShift;
+            fetchPage = readPages[fetchPageIndex];
+        }
+
+        if (fetchPage != nullptr) [[likely]]
+            return fetchPage[address & memoryPageMask];
+        return ReadByteSlow(address);
+    }
+
+    inline uint8_t MemoryBus::ReadByte(const Register reg)
+    {
+        return (ReadByte(reg.Value()));
+    }
+
+    inline void MemoryBus::WriteByte(const uint16_t address, const uint8_t value)
+    {
+        uint8_t* page = writePages[address >> memoryPageShift];
+
+        if (page != nullptr) [[likely]]
+        {
+            page[address & memoryPageMask] = value;
+            dirtyMarkers[address >> memoryPageShift].Mark();
+        }
+        else
+            WriteByteSlow(address, value);
+    }
+
+    inline void MemoryBus::WriteByte(const Register reg, const uint8_t value)
+    {
+        WriteByte(reg.Value(), value);
+    }
+
 }
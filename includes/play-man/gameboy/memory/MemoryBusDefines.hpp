@@ -59,9 +59,24 @@ constexpr uint16_t prohibitedAddressEnd = 0xFEFF;
 constexpr uint16_t ioAddressStart = 0xFF00;
 constexpr uint16_t ioAddressEnd = 0xFF00;
 
+// Addresses for the timer registers, DIV, TIMA, TMA and TAC
+constexpr uint16_t timerAddressStart = 0xFF04;
+constexpr uint16_t timerAddressEnd = 0xFF07;
+constexpr uint16_t dividerAddress = 0xFF04;
+constexpr uint16_t timerCounterAddress = 0xFF05;
+constexpr uint16_t timerModuloAddress = 0xFF06;
+constexpr uint16_t timerControlAddress = 0xFF07;
+
+// Address for the interrupt flag register (IF), the requested interrupts
+constexpr uint16_t interruptFlagAddress = 0xFF0F;
+
 // Addresses for the high RAM
 constexpr uint16_t hRamAddressStart = 0xFF80;
 constexpr uint16_t hRamAddressEnd = 0xFFFE;
 
 // Address for the interrupt register 
 constexpr uint16_t interruptAddress = 0xFFFF;
+
+// Address for the work RAM bank select register (SVBK), only used in CGB mode
+constexpr uint16_t wRamBankSelectAddress = 0xFF70;
+constexpr uint8_t  wRamBankSelectMask = 0b0000'0111;
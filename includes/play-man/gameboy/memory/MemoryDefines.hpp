@@ -24,4 +24,13 @@ namespace GameBoy {
 
     using WorkRamBank = std::array<uint8_t, 4 * KiB>; 
 
+    /**
+     * @brief The memory bus splits the address space into pages of memoryPageSize bytes,
+     * each page either points directly into host memory or is handled by the slow path.
+     */
+    constexpr uint32_t memoryPageShift = 8;
+    constexpr uint32_t memoryPageSize = 1 << memoryPageShift;
+    constexpr uint32_t memoryPageMask = memoryPageSize - 1;
+    constexpr uint32_t memoryPageCount = 0x10000 / memoryPageSize;
+
 }
@@ -0,0 +1,147 @@
+// ****************************************************************************** //
+//   _______   __                              __       __                        //
+//  /       \ /  |                            /  \     /  |                       //
+//  $$$$$$$  |$$ |  ______   __    __         $$  \   /$$ |  ______   _______     //
+//  $$ |__$$ |$$ | /      \ /  |  /  | ______ $$$  \ /$$$ | /      \ /       \    //
+//  $$    $$/ $$ | $$$$$$  |$$ |  $$ |/      |$$$$  /$$$$ | $$$$$$  |$$$$$$$  |   //
+//  $$$$$$$/  $$ | /    $$ |$$ |  $$ |$$$$$$/ $$ $$ $$/$$ | /    $$ |$$ |  $$ |   //
+//  $$ |      $$ |/$$$$$$$ |$$ \__$$ |        $$ |$$$/ $$ |/$$$$$$$ |$$ |  $$ |   //
+//  $$ |      $$ |$$    $$ |$$    $$ |        $$ | $/  $$ |$$    $$ |$$ |  $$ |   //
+//  $$/       $$/  $$$$$$$/  $$$$$$$ |        $$/      $$/  $$$$$$$/ $$/   $$/    //
+//                          /  \__$$ |                                            //
+//                          $$    $$/                                             //
+//                           $$$$$$/                                              //
+//                                                                                //
+//                            By: K1ngmar and rvan-mee                            //
+// ****************************************************************************** //
+
+#pragma once
+
+#include <span>
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+#include <vector>
+
+namespace GameBoy {
+
+    /**
+     * @brief Builds the identifier of a save state section from its four character name.
+     */
+    constexpr uint32_t MakeSaveStateId(const char (&name)[5])
+    {
+        return static_cast<uint32_t>(name[0]) | static_cast<uint32_t>(name[1]) << 8 |
+               static_cast<uint32_t>(name[2]) << 16 | static_cast<uint32_t>(name[3]) << 24;
+    }
+
+    constexpr uint32_t saveStateMagic = MakeSaveStateId("PMGB");
+
+    /**
+     * @brief Incremented whenever the contents of a section change, states of other versions are rejected.
+     */
+    constexpr uint32_t saveStateVersion = 1;
+
+    /**
+     * @brief Writes a save state: a header (magic and version) followed by sections.
+     * 
+     * Every section starts with its identifier and size, followed by the component's state as
+     * fixed size fields and raw memory, all copied as is. The state is only meant to be loaded
+     * by the same version on a machine with the same byte order.
+     */
+    class SaveStateWriter
+    {
+    private:
+        std::vector<uint8_t>&   buffer;
+        size_t                  sectionStart = 0;
+
+    public:
+        SaveStateWriter() = delete;
+
+        /**
+         * @brief Replaces the contents of the buffer with the header, its capacity is reused.
+         */
+        SaveStateWriter(std::vector<uint8_t>& _buffer);
+
+        /**
+         * @brief Starts a section, has to be closed with EndSection before the next one is started.
+         */
+        void    BeginSection(const uint32_t id);
+        void    EndSection();
+
+        void    WriteBytes(const void* data, const size_t size);
+
+        template <typename T>
+        void    Write(const T& value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            WriteBytes(&value, sizeof(T));
+        }
+    };
+
+    /**
+     * @brief Reads a save state written by SaveStateWriter, the sections have to be read in the order they were written.
+     * 
+     * @note Every function throws a std::runtime_error when the data does not match what is read,
+     *       e.g. a different version, section or section size.
+     */
+    class SaveStateReader
+    {
+    private:
+        std::span<const uint8_t>    data;
+        size_t                      position = 0;
+        size_t                      sectionEnd = 0;
+
+    public:
+        SaveStateReader() = delete;
+
+        /**
+         * @brief Checks the header of the state.
+         */
+        SaveStateReader(std::span<const uint8_t> _data) noexcept(false);
+
+        /**
+         * @brief Starts reading the next section, which has to have the given identifier.
+         */
+        void    BeginSection(const uint32_t id) noexcept(false);
+
+        /**
+         * @brief Finishes the current section, which has to be read completely.
+         */
+        void    EndSection() noexcept(false);
+
+        /**
+         * @brief Checks that all of the data has been read, so nothing follows the last section.
+         */
+        void    Finish() noexcept(false);
+
+        void    ReadBytes(void* destination, const size_t size) noexcept(false);
+
+        template <typename T>
+        void    Read(T& value) noexcept(false)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            static_assert(!std::is_same_v<T, bool>, "Use ReadBool, not every byte is a valid bool");
+            ReadBytes(&value, sizeof(T));
+        }
+
+        template <typename T>
+        T       Read() noexcept(false)
+        {
+            T value;
+            Read(value);
+            return value;
+        }
+
+        /**
+         * @brief Reads a bool written as a single byte, any other value than 0 or 1 is rejected
+         *        as it can not be copied into a bool.
+         */
+        bool    ReadBool() noexcept(false);
+
+        /**
+         * @brief Skips fields of the current section without reading them.
+         */
+        void    Skip(const size_t size) noexcept(false);
+    };
+
+}
@@ -0,0 +1,154 @@
+// ****************************************************************************** //
+//   _______   __                              __       __                        //
+//  /       \ /  |                            /  \     /  |                       //
+//  $$$$$$$  |$$ |  ______   __    __         $$  \   /$$ |  ______   _______     //
+//  $$ |__$$ |$$ | /      \ /  |  /  | ______ $$$  \ /$$$ | /      \ /       \    //
+//  $$    $$/ $$ | $$$$$$  |$$ |  $$ |/      |$$$$  /$$$$ | $$$$$$  |$$$$$$$  |   //
+//  $$$$$$$/  $$ | /    $$ |$$ |  $$ |$$$$$$/ $$ $$ $$/$$ | /    $$ |$$ |  $$ |   //
+//  $$ |      $$ |/$$$$$$$ |$$ \__$$ |        $$ |$$$/ $$ |/$$$$$$$ |$$ |  $$ |   //
+//  $$ |      $$ |$$    $$ |$$    $$ |        $$ | $/  $$ |$$    $$ |$$ |  $$ |   //
+//  $$/       $$/  $$$$$$$/  $$$$$$$ |        $$/      $$/  $$$$$$$/ $$/   $$/    //
+//                          /  \__$$ |                                            //
+//                          $$    $$/                                             //
+//                           $$$$$$/                                              //
+//                                                                                //
+//                            By: K1ngmar and rvan-mee                            //
+// ****************************************************************************** //
+
+#pragma once
+
+#include <play-man/containers/EnumIndexableArray.hpp>
+#include <play-man/gameboy/savestate/SaveState.hpp>
+#include <play-man/utility/EnumMacro.hpp>
+
+#include <functional>
+#include <limits>
+#include <vector>
+#include <stdint.h>
+
+namespace GameBoy
+{
+	/**
+	 * @brief The events components can schedule, every event can be pending at most once.
+	 */
+	#define SCHEDULER_EVENT_SEQ(x, n) \
+		x(n, TimerOverflow)           \
+		x(n, LcdModeChange)           \
+		x(n, SerialTransferDone)      \
+		x(n, DmaEnd)                  \
+		x(n, RealTimeClockTick)
+
+	CREATE_ENUM_WITH_UTILS(SCHEDULER_EVENT_SEQ, SchedulerEvent)
+	constexpr size_t numberOfSchedulerEvents = ENUM_ENTRY_COUNT(SCHEDULER_EVENT_SEQ, SchedulerEvent);
+	#undef SCHEDULER_EVENT_SEQ
+
+	/**
+	 * @brief Keeps the timestamped events of the components, ordered by their deadline (in machine cycles).
+	 * 
+	 * Instead of ticking every component every cycle, the cpu runs until the next deadline
+	 * and only then hands control to the component that scheduled the event.
+	 * 
+	 * @note Rescheduling or cancelling an event leaves its old entry in the queue,
+	 *       entries that no longer match the event's deadline are skipped.
+	 */
+	class Scheduler
+	{
+	public:
+
+		/**
+		 * @brief Called once the event is due.
+		 * @param deadline The cycle the event was scheduled for, the cpu can be a few cycles past it.
+		 */
+		using EventHandler = std::function<void(size_t deadline)>;
+
+		/**
+		 * @brief The deadline of events that are not scheduled.
+		 */
+		static constexpr size_t notScheduled = std::numeric_limits<size_t>::max();
+
+	private:
+
+		struct Entry
+		{
+			size_t deadline;
+			SchedulerEvent event;
+		};
+
+		std::vector<Entry> queue; /*!< Min heap on the deadline. */
+		EnumIndexableArray<SchedulerEvent, size_t, numberOfSchedulerEvents> deadlines;
+		EnumIndexableArray<SchedulerEvent, EventHandler, numberOfSchedulerEvents> handlers;
+
+		/**
+		 * @brief Pops the entries of rescheduled and cancelled events from the top of the queue.
+		 */
+		void DropStaleEntries();
+
+		/**
+		 * @brief Rebuilds the queue from the pending events, so stale entries do not pile up.
+		 */
+		void Compact();
+
+	public:
+
+		Scheduler();
+
+		/**
+		 * @brief Sets the function handling the event, replaces the previous handler.
+		 */
+		void SetHandler(SchedulerEvent event, EventHandler handler);
+
+		/**
+		 * @brief Schedules the event, replacing the deadline it was scheduled for before.
+		 * @param deadline The cycle the event is due.
+		 */
+		void Schedule(SchedulerEvent event, size_t deadline);
+
+		/**
+		 * @brief Cancels the event, does nothing when it is not scheduled.
+		 */
+		void Cancel(SchedulerEvent event);
+
+		/**
+		 * @brief Cancels all events, the handlers are kept.
+		 */
+		void Clear();
+
+		/**
+		 * @brief Returns the cycle the event is due, notScheduled when it is not scheduled.
+		 */
+		size_t Deadline(SchedulerEvent event) const
+		{
+			return deadlines[event];
+		}
+
+		/**
+		 * @brief Returns the deadline of the first event, notScheduled when nothing is scheduled.
+		 */
+		size_t NextDeadline() const
+		{
+			return queue.empty() ? notScheduled : queue.front().deadline;
+		}
+
+		/**
+		 * @brief Runs the handlers of all events due at the given cycle, in order of their deadline.
+		 * 
+		 * @note Events scheduled by the handlers are run as well when they are already due.
+		 */
+		void RunDueEvents(size_t now);
+
+		/**
+		 * @brief Writes the deadlines of the events, the handlers are not part of the state.
+		 */
+		void SaveState(SaveStateWriter& writer) const;
+
+		/**
+		 * @brief Replaces the scheduled events with those of the state, the handlers are kept.
+		 */
+		void LoadState(SaveStateReader& reader) noexcept(false);
+
+		/**
+		 * @brief Reads past the section LoadState would read, checking it without loading anything.
+		 */
+		void ValidateState(SaveStateReader& reader) const noexcept(false);
+	};
+}
@@ -0,0 +1,113 @@
+// ****************************************************************************** //
+//   _______   __                              __       __                        //
+//  /       \ /  |                            /  \     /  |                       //
+//  $$$$$$$  |$$ |  ______   __    __         $$  \   /$$ |  ______   _______     //
+//  $$ |__$$ |$$ | /      \ /  |  /  | ______ $$$  \ /$$$ | /      \ /       \    //
+//  $$    $$/ $$ | $$$$$$  |$$ |  $$ |/      |$$$$  /$$$$ | $$$$$$  |$$$$$$$  |   //
+//  $$$$$$$/  $$ | /    $$ |$$ |  $$ |$$$$$$/ $$ $$ $$/$$ | /    $$ |$$ |  $$ |   //
+//  $$ |      $$ |/$$$$$$$ |$$ \__$$ |        $$ |$$$/ $$ |/$$$$$$$ |$$ |  $$ |   //
+//  $$ |      $$ |$$    $$ |$$    $$ |        $$ | $/  $$ |$$    $$ |$$ |  $$ |   //
+//  $$/       $$/  $$$$$$$/  $$$$$$$ |        $$/      $$/  $$$$$$$/ $$/   $$/    //
+//                          /  \__$$ |                                            //
+//                          $$    $$/                                             //
+//                           $$$$$$/                                              //
+//                                                                                //
+//                            By: K1ngmar and rvan-mee                            //
+// ****************************************************************************** //
+
+#pragma once
+
+#include <play-man/gameboy/cpu/CpuCore.hpp>
+#include <play-man/gameboy/scheduler/Scheduler.hpp>
+
+#include <stdint.h>
+
+namespace GameBoy
+{
+	/**
+	 * @brief The value of the system counter (in machine cycles) after the boot ROM, DIV reads 0xAB.
+	 */
+	constexpr uint16_t dividerCounterAfterBootRom = 0x2AF3;
+
+	/**
+	 * @brief The timer and divider registers (DIV, TIMA, TMA and TAC).
+	 * 
+	 * The timer is not ticked by the cpu, it remembers the cycle it was last synchronized to and
+	 * catches up on the cycles that have passed since, whenever one of its registers gets accessed.
+	 * To still request the timer interrupt on time it schedules the cycle TIMA overflows.
+	 * 
+	 * @note TIMA is reloaded with TMA in the same cycle it overflows,
+	 *       the hardware delays the reload (and the interrupt) by one machine cycle.
+	 * @note https://gbdev.io/pandocs/Timer_and_Divider_Registers.html
+	 */
+	class Timer
+	{
+		CpuCore&		core;
+		Scheduler&		scheduler;
+		const size_t&	cycles; /*!< The cpu's cycle counter, the timer's clock. */
+
+		size_t		lastSynchronized = 0; /*!< The cycle the registers below are up to date with. */
+		uint16_t	counter = dividerCounterAfterBootRom; /*!< The system counter in machine cycles, DIV is bits 6-13. */
+		uint8_t		timerCounter = 0; /*!< TIMA */
+		uint8_t		timerModulo = 0; /*!< TMA */
+		uint8_t		timerControl = 0; /*!< TAC */
+
+		/**
+		 * @brief Whether TIMA is counting, bit 2 of TAC.
+		 */
+		bool IsEnabled() const
+		{
+			return (timerControl & 0b100) != 0;
+		}
+
+		/**
+		 * @brief The amount of machine cycles between two TIMA increments is 1 << shift,
+		 *        TIMA increments when bit (shift - 1) of the system counter falls.
+		 */
+		uint8_t CounterShift() const;
+
+		/**
+		 * @brief Adds increments to TIMA, reloading TMA and requesting the interrupt when it overflows.
+		 */
+		void IncrementTimerCounter(size_t increments);
+
+		/**
+		 * @brief Schedules the cycle TIMA overflows, or cancels the event when the timer is disabled.
+		 */
+		void ScheduleOverflow();
+
+	public:
+
+		Timer() = delete;
+		Timer(CpuCore& _core, Scheduler& _scheduler, const size_t& _cycles);
+
+		Timer(const Timer&) = delete;
+		Timer& operator=(const Timer&) = delete;
+
+		/**
+		 * @brief Catches up on the cycles that have passed since the last synchronization.
+		 */
+		void Synchronize();
+
+		/**
+		 * @brief Reads one of the timer registers, timerAddressStart - timerAddressEnd.
+		 */
+		uint8_t ReadByte(const uint16_t address);
+
+		/**
+		 * @brief Writes one of the timer registers, timerAddressStart - timerAddressEnd.
+		 */
+		void WriteByte(const uint16_t address, const uint8_t value);
+
+		/**
+		 * @brief Writes the registers, the overflow event is part of the scheduler's state.
+		 */
+		void SaveState(SaveStateWriter& writer) const;
+		void LoadState(SaveStateReader& reader) noexcept(false);
+
+		/**
+		 * @brief Reads past the section LoadState would read, checking it without loading anything.
+		 */
+		void ValidateState(SaveStateReader& reader) const noexcept(false);
+	};
+}
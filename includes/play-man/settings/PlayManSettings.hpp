@@ -21,6 +21,19 @@
 
 #include <filesystem>
 
+#define TIMING_ACCURACY_SEQ(X, n) \
+	X(n, Fast) \
+	X(n, Accurate)
+
+/**
+ * @brief How precisely the emulated components are timed.
+ *        Fast: time advances once per instruction, by the instruction's cycle count.
+ *        Accurate: time advances on every memory access, so reads in the middle of an instruction
+ *                  see the other components in the state of that machine cycle.
+ */
+CREATE_ENUM_WITH_UTILS(TIMING_ACCURACY_SEQ, TimingAccuracy)
+#undef TIMING_ACCURACY_SEQ
+
 /**
  * @brief Struct containing all settings for play-man not specific to any emulator.
  */
@@ -32,6 +45,16 @@ struct PlayManSettings : public ISettings<PlayManSettings>
 	std::filesystem::path logDirectory;
 	static constexpr std::string_view defaultLogDirectory = "Logging";
 
+	TimingAccuracy timingAccuracy;
+	static constexpr TimingAccuracy defaultTimingAccuracy = TimingAccuracy::Fast;
+
+	/**
+	 * @brief The amount of emulated frames between writing battery saves back to disk,
+	 *        0 only writes them back on shutdown.
+	 */
+	uint32_t saveFlushIntervalFrames;
+	static constexpr uint32_t defaultSaveFlushIntervalFrames = 600;
+
 	/**
 	 * @brief -.
 	 */
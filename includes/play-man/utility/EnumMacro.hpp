@@ -46,6 +46,13 @@
 #define __ENUM_CREATION(...) __GET_CORRECT_MACRO(__VA_ARGS__, __CREATE_DEFINED_ENUM, __CREATE_DEFAULT_ENUM, 0)(__VA_ARGS__)
 #define __ENUM_TO_STRING_CASE(...) __GET_CORRECT_MACRO(__VA_ARGS__, __DEFINED_ENUM_TO_STRING_CASE, __DEFAULT_ENUM_TO_STRING_CASE, 0)(__VA_ARGS__)
 #define __ENUM_TO_JSON_STRING(...) __GET_CORRECT_MACRO(__VA_ARGS__, __DEFINED_ENUM_TO_JSON_STRING, __DEFAULT_ENUM_TO_JSON_STRING, 0)(__VA_ARGS__)
+#define __COUNT_ENUM_ENTRY(...) + 1
+
+/**
+ * @brief The amount of entries in an ENUM_DEFINITION as used by CREATE_ENUM_WITH_UTILS, e.g. to size an EnumIndexableArray.
+ *        Only matches the size of the value range when the entries use the default values.
+ */
+#define ENUM_ENTRY_COUNT(ENUM_DEFINITION, enum_class_name) (0 ENUM_DEFINITION(__COUNT_ENUM_ENTRY, enum_class_name))
 
 /**
  * @brief Defines an enum with optionally specified values, and some utility functions like to string for the enum,
@@ -0,0 +1,142 @@
+// ****************************************************************************** //
+//   _______   __                              __       __                        //
+//  /       \ /  |                            /  \     /  |                       //
+//  $$$$$$$  |$$ |  ______   __    __         $$  \   /$$ |  ______   _______     //
+//  $$ |__$$ |$$ | /      \ /  |  /  | ______ $$$  \ /$$$ | /      \ /       \    //
+//  $$    $$/ $$ | $$$$$$  |$$ |  $$ |/      |$$$$  /$$$$ | $$$$$$  |$$$$$$$  |   //
+//  $$$$$$$/  $$ | /    $$ |$$ |  $$ |$$$$$$/ $$ $$ $$/$$ | /    $$ |$$ |  $$ |   //
+//  $$ |      $$ |/$$$$$$$ |$$ \__$$ |        $$ |$$$/ $$ |/$$$$$$$ |$$ |  $$ |   //
+//  $$ |      $$ |$$    $$ |$$    $$ |        $$ | $/  $$ |$$    $$ |$$ |  $$ |   //
+//  $$/       $$/  $$$$$$$/  $$$$$$$ |        $$/      $$/  $$$$$$$/ $$/   $$/    //
+//                          /  \__$$ |                                            //
+//                          $$    $$/                                             //
+//                           $$$$$$/                                              //
+//                                                                                //
+//                            By: K1ngmar and rvan-mee                            //
+// ****************************************************************************** //
+
+#pragma once
+
+#include <filesystem>
+#include <vector>
+#include <stdint.h>
+#include <stddef.h>
+
+namespace Utility
+{
+	/**
+	 * @brief Read only view of a whole file.
+	 * 
+	 * On linux and macos the file is memory mapped (MAP_PRIVATE), so the data is paged in on demand
+	 * straight from the page cache without being copied. Other platforms read the file into memory.
+	 * 
+	 * @note The data stays valid for the lifetime of the object, moving it does not invalidate it.
+	 */
+	class MappedFile
+	{
+	private:
+		const uint8_t*			mappedData = nullptr;
+		size_t					mappedSize = 0;
+
+		/**
+		 * @brief Holds the file contents when the file could not be mapped.
+		 */
+		std::vector<uint8_t>	fallbackData;
+
+		void Unmap();
+
+	public:
+		MappedFile() = default;
+
+		/**
+		 * @brief Maps the given file.
+		 * @throws std::runtime_error if the file could not be opened.
+		 */
+		MappedFile(const std::filesystem::path& filePath) noexcept(false);
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		MappedFile(MappedFile&& other) noexcept;
+		MappedFile& operator=(MappedFile&& other) noexcept;
+
+		const uint8_t*	data() const { return mappedData; }
+		size_t			size() const { return mappedSize; }
+
+		/**
+		 * @return Whether the data is backed by a memory mapping instead of a copy.
+		 */
+		bool			IsMapped() const { return mappedData != nullptr && fallbackData.empty(); }
+	};
+
+	/**
+	 * @brief Writable view of a file, changes to the data end up in the file.
+	 * 
+	 * On linux and macos the file is memory mapped (MAP_SHARED), so writing the data costs nothing extra
+	 * and the kernel writes the modified pages back in the background. Other platforms keep a copy
+	 * of the file in memory and rewrite the whole file on Flush.
+	 * 
+	 * @note The data stays valid for the lifetime of the object, moving it does not invalidate it.
+	 */
+	class WritableMappedFile
+	{
+	private:
+		uint8_t*				mappedData = nullptr;
+		size_t					mappedSize = 0;
+
+		/**
+		 * @brief Holds the file contents when the file could not be mapped.
+		 */
+		std::vector<uint8_t>	fallbackData;
+		std::filesystem::path	fallbackPath;
+
+		/**
+		 * @brief The file while it is mapped, kept open to hold the lock on it, -1 otherwise.
+		 */
+		int						lockedFile = -1;
+
+		void Unmap();
+
+	public:
+		WritableMappedFile() = default;
+
+		/**
+		 * @brief Opens the given file, creating it if it does not exist, and maps its first size bytes.
+		 * 
+		 * @note A file shorter than size is extended with zeroes, a longer file is left as is.
+		 * @note On linux and macos the file is locked (flock) for as long as it is mapped,
+		 *       so other processes or objects can not map the same file at the same time.
+		 * @throws std::runtime_error if the file could not be opened or created, or is already in use.
+		 */
+		WritableMappedFile(const std::filesystem::path& filePath, size_t size) noexcept(false);
+
+		/**
+		 * @brief Flushes and waits for the data to be written before unmapping it.
+		 */
+		~WritableMappedFile();
+
+		WritableMappedFile(const WritableMappedFile&) = delete;
+		WritableMappedFile& operator=(const WritableMappedFile&) = delete;
+
+		WritableMappedFile(WritableMappedFile&& other) noexcept;
+		WritableMappedFile& operator=(WritableMappedFile&& other) noexcept;
+
+		uint8_t*		data() { return mappedData; }
+		const uint8_t*	data() const { return mappedData; }
+		size_t			size() const { return mappedSize; }
+
+		/**
+		 * @return Whether the data is backed by a memory mapping instead of a copy.
+		 */
+		bool			IsMapped() const { return mappedData != nullptr && fallbackData.empty(); }
+
+		/**
+		 * @brief Writes the modified data back to the file.
+		 * 
+		 * @param wait Whether to block until the data is on disk, otherwise the writeback is only scheduled.
+		 */
+		void			Flush(bool wait = false);
+	};
+
+} /* namespace Utility */
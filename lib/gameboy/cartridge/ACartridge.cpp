@@ -16,21 +16,30 @@
 // ****************************************************************************** //
 
 #include <play-man/gameboy/cartridge/ACartridge.hpp>
+#include <stdexcept>
 
 namespace GameBoy {
 
-    ACartridge::ACartridge(std::unique_ptr<Rom> _rom) : rom(std::move(_rom))
+    ACartridge::ACartridge(std::shared_ptr<const Rom> _rom, std::filesystem::path _filePath)
+        : rom(std::move(_rom)), filePath(std::move(_filePath))
     {
         InitRamBanks();
     };
 
     void ACartridge::InitRamBanks()
     {
-        const uint8_t ramBankCount = rom->GetRamBankCount();
+        ramBanks = MemoryBanks(rom->GetRamBankCount(), RamBankSize);
+        ramDirtyPages = DirtyPages(ramBanks.SizeInBytes());
+    }
 
-        ramBanks.resize(ramBankCount);
-        for (uint32_t i = 0; i < ramBankCount; i++)
-            ramBanks[i].resize(RamBankSize);
+    const Rom&      ACartridge::GetRom() const
+    {
+        return *rom;
+    }
+
+    const std::filesystem::path&    ACartridge::GetFilePath() const
+    {
+        return filePath;
     }
 
     CartridgeType   ACartridge::GetType() const
@@ -48,14 +57,95 @@ namespace GameBoy {
         return rom->GetRomBankCount();
     }
 
+    bool            ACartridge::HasBattery() const
+    {
+        switch (GetType())
+        {
+            case CartridgeType::MBC1_RAM_BATTERY:
+            case CartridgeType::MBC2_BATTERY:
+            case CartridgeType::ROM_RAM_BATTERY:
+            case CartridgeType::MMM01_RAM_BATTERY:
+            case CartridgeType::MBC3_TIMER_BATTERY:
+            case CartridgeType::MBC3_TIMER_RAM_BATTERY:
+            case CartridgeType::MBC3_RAM_BATTERY:
+            case CartridgeType::MBC5_RAM_BATTERY:
+            case CartridgeType::MBC5_RUMBLE_RAM_BATTERY:
+            case CartridgeType::MBC7_SENSOR_RUMBLE_RAM_BATTERY:
+            case CartridgeType::HUC1_RAM_BATTERY:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    void    ACartridge::AttachSaveFile(const std::filesystem::path& filePath) noexcept(false)
+    {
+        if (ramBanks.SizeInBytes() == 0)
+            return ;
+
+        ramBanks = MemoryBanks(filePath, ramBanks.size(), ramBanks.BankSize());
+        // All of the RAM got replaced by the contents of the file.
+        ramDirtyPages.MarkAll();
+        UpdateBanks();
+    }
+
+    void    ACartridge::FlushSaveFile(bool wait)
+    {
+        ramBanks.Flush(wait);
+    }
+
+    void    ACartridge::SaveState(SaveStateWriter& writer) const
+    {
+        writer.BeginSection(MakeSaveStateId("CART"));
+        writer.Write(static_cast<uint8_t>(GetType()));
+        writer.Write(static_cast<uint32_t>(ramBanks.SizeInBytes()));
+        writer.WriteBytes(ramBanks.data(), ramBanks.SizeInBytes());
+        SaveRegisters(writer);
+        writer.EndSection();
+    }
+
+    void    ACartridge::ValidateState(SaveStateReader& reader) const noexcept(false)
+    {
+        reader.BeginSection(MakeSaveStateId("CART"));
+        if (reader.Read<uint8_t>() != static_cast<uint8_t>(GetType()) ||
+            reader.Read<uint32_t>() != ramBanks.SizeInBytes())
+        {
+            throw std::runtime_error("Save state is of a different cartridge");
+        }
+        reader.Skip(ramBanks.SizeInBytes());
+        ValidateRegisters(reader);
+        reader.EndSection();
+    }
+
+    void    ACartridge::LoadState(SaveStateReader& reader) noexcept(false)
+    {
+        reader.BeginSection(MakeSaveStateId("CART"));
+        if (reader.Read<uint8_t>() != static_cast<uint8_t>(GetType()) ||
+            reader.Read<uint32_t>() != ramBanks.SizeInBytes())
+        {
+            throw std::runtime_error("Save state is of a different cartridge");
+        }
+        reader.ReadBytes(ramBanks.data(), ramBanks.SizeInBytes());
+        LoadRegisters(reader);
+        reader.EndSection();
+
+        ramDirtyPages.MarkAll();
+        UpdateBanks();
+    }
+
     void    ACartridge::LoadTestRom(const char* filePath)
     {
-        rom->LoadTestRom(filePath);
+        auto testRom = std::make_shared<Rom>(*rom);
+
+        testRom->LoadTestRom(filePath);
+        rom = std::move(testRom);
+        UpdateBanks();
     }
 
     std::ostream& operator << (std::ostream& lhs, ACartridge& cart)
     {
-        lhs << "Cartridge: " << *cart.rom << std::endl;
+        lhs << "Cartridge located on: " << cart.filePath.string() << std::endl;
+        lhs << cart.rom->GetHeader() << std::endl;
         return (lhs);
     }
 
@@ -16,7 +16,7 @@
 // ****************************************************************************** //
 
 #include <play-man/gameboy/cartridge/Cartridge.hpp>
-#include <play-man/gameboy/cartridge/Rom.hpp>
+#include <play-man/gameboy/cartridge/RomCache.hpp>
 #include <play-man/logger/Logger.hpp>
 #include <sstream>
 
@@ -25,33 +25,33 @@ namespace GameBoy
 
 std::shared_ptr<ACartridge> MakeCartridge(const char* filePath) noexcept(false)
 {
-    auto rom = std::make_unique<Rom>(filePath);
+    auto rom = LoadSharedRom(filePath);
 
     switch (rom->GetCartridgeType())
     {
         case CartridgeType::ROM_ONLY:
         case CartridgeType::ROM_RAM:
         case CartridgeType::ROM_RAM_BATTERY:
-            return std::make_shared<NoMBCCartridge>(std::move(rom));
+            return std::make_shared<NoMBCCartridge>(std::move(rom), filePath);
         case CartridgeType::MBC1:
         case CartridgeType::MBC1_RAM:
         case CartridgeType::MBC1_RAM_BATTERY:
-            return std::make_shared<MBC1Cartridge>(std::move(rom));
+            return std::make_shared<MBC1Cartridge>(std::move(rom), filePath);
         case CartridgeType::MBC2:
         case CartridgeType::MBC2_BATTERY:
-            return std::make_shared<MBC2Cartridge>(std::move(rom));
+            return std::make_shared<MBC2Cartridge>(std::move(rom), filePath);
         case CartridgeType::MBC3_RAM:
         case CartridgeType::MBC3_RAM_BATTERY:
         case CartridgeType::MBC3_TIMER_BATTERY:
         case CartridgeType::MBC3_TIMER_RAM_BATTERY:
-            return std::make_shared<MBC3Cartridge>(std::move(rom));
+            return std::make_shared<MBC3Cartridge>(std::move(rom), filePath);
         case CartridgeType::MBC5:
         case CartridgeType::MBC5_RAM:
         case CartridgeType::MBC5_RAM_BATTERY:
         case CartridgeType::MBC5_RUMBLE:
         case CartridgeType::MBC5_RUMBLE_RAM:
         case CartridgeType::MBC5_RUMBLE_RAM_BATTERY:
-            return std::make_shared<MBC5Cartridge>(std::move(rom));
+            return std::make_shared<MBC5Cartridge>(std::move(rom), filePath);
         default:
             std::stringstream error;
             error << "Unsupported ROM type: ";
@@ -68,7 +68,7 @@ static constexpr uint8_t BankingModeSelectMask = 0b00000001;
 namespace GameBoy
 {
 
-    MBC1Cartridge::MBC1Cartridge(std::unique_ptr<Rom> rom) : ACartridge(std::move(rom))
+    MBC1Cartridge::MBC1Cartridge(std::shared_ptr<const Rom> rom, std::filesystem::path filePath) : ACartridge(std::move(rom), std::move(filePath))
     {
         secondarySelectedBankRegister = DefaultSecondarySelectedBankBits;
         bankRegisterBitCount = DefaultBankRegisterBitCount;
@@ -79,6 +79,41 @@ namespace GameBoy
         cartIsMBC1M = CheckMBC1M();
         if (cartIsMBC1M)
             bankRegisterBitCount = MBC1MBankRegisterBitCount;
+        UpdateBanks();
+    }
+
+    void MBC1Cartridge::UpdateBanks()
+    {
+        const uint32_t romBankCount = rom->GetRomBankCount();
+        const uint8_t selectedRomBank0 = SelectedRomBank0();
+        const uint8_t selectedRomBankN = SelectedRomBankN();
+        const uint8_t selectedRamBank = SelectedRamBank();
+
+        romBank0 = selectedRomBank0 < romBankCount ? rom->GetBankData(selectedRomBank0) : nullptr;
+        romBankN = selectedRomBankN < romBankCount ? rom->GetBankData(selectedRomBankN) : nullptr;
+        ramBank = ramEnabled && selectedRamBank < ramBanks.size() ? ramBanks[selectedRamBank].data() : nullptr;
+    }
+
+    void    MBC1Cartridge::SaveRegisters(SaveStateWriter& writer) const
+    {
+        writer.Write(ramEnabled);
+        writer.Write(selectedBankRegister);
+        writer.Write(secondarySelectedBankRegister);
+        writer.Write(bankingModeSelect);
+    }
+
+    void    MBC1Cartridge::LoadRegisters(SaveStateReader& reader) noexcept(false)
+    {
+        ramEnabled = reader.ReadBool();
+        reader.Read(selectedBankRegister);
+        reader.Read(secondarySelectedBankRegister);
+        reader.Read(bankingModeSelect);
+    }
+
+    void    MBC1Cartridge::ValidateRegisters(SaveStateReader& reader) const noexcept(false)
+    {
+        reader.ReadBool();
+        reader.Skip(sizeof(selectedBankRegister) + sizeof(secondarySelectedBankRegister) + sizeof(bankingModeSelect));
     }
 
     uint8_t MBC1Cartridge::RomBankMask()
@@ -116,63 +151,82 @@ namespace GameBoy
         return true;
     }
 
+    uint8_t MBC1Cartridge::SelectedRomBank0()
+    {
+        uint8_t selectedBank = 0x00;
+        if (rom->GetRomBankCount() >= AmountOfBanksToBeLargeRom && bankingModeSelect == AdvancedBankingMode)
+        {
+            // For large ROMs this area can be banked, to make sure we address
+            // the right bank we need to use the secondary bits bank which represents
+            // the top 2 bits, hence the bit shift.
+            // This means we can access the 0x00, 0x20, 0x40 and 0x60 banks
+            // for a regular MBC1 and 0x00, 0x10, 0x20, and 0x30 for MCB1M cartridges
+            selectedBank = secondarySelectedBankRegister << bankRegisterBitCount;
+        }
+        return selectedBank;
+    }
+
+    uint8_t MBC1Cartridge::SelectedRomBankN()
+    {
+        // Depending on the amount of banks of the cartridge we dont have to use the entire
+        // register to get the selected bank e.g: a 256 KiB cart only needs a 4-bit bank number
+        // to address all of its 16 banks, so this register is masked to 4 bits.
+        // The upper bit would be ignored for bank selection. 
+        uint8_t selectedBank = selectedBankRegister & RomBankMask();
+
+        // If the main 5-bit ROM banking register is 0, it reads the bank as if it was set to 1.
+        // MBC1M carts or smaller ROM cartridges still use the full 5 bits for this comparison as well.
+        // The comparison is done on the full 5 bit register for both MBC1M carts or smaller ROM cartridges.
+        // This means it is still possible to address bank 0 for cartridges that contain a 256 KiB or smaller ROM.
+        if ((selectedBankRegister & 0b00011111) == 0x00)
+            selectedBank += 1;
+
+        if (rom->GetRomBankCount() >= AmountOfBanksToBeLargeRom && bankingModeSelect == AdvancedBankingMode)
+        {
+            selectedBank |= secondarySelectedBankRegister << bankRegisterBitCount;
+        }
+        return selectedBank;
+    }
+
+    uint8_t MBC1Cartridge::SelectedRamBank()
+    {
+        // The available amount of RAM banks on a MBC1 cartridge ranges from
+        // 1 bank to 4 banks (8KiB to 4 banks of 8KiB resulting in 32KiB).
+        // Only in advanced banking mode the secondary register selects the bank.
+        if (rom->GetRamBankCount() > 1 && bankingModeSelect == AdvancedBankingMode)
+            return secondarySelectedBankRegister;
+        return 0;
+    }
+
     uint8_t MBC1Cartridge::ReadByte(const uint16_t address)
     {
         if (address >= RomAddressStart && address <= RomAddressEnd)
         {
-            uint8_t selectedBank = 0x00;
-            if (rom->GetRomBankCount() >= AmountOfBanksToBeLargeRom && bankingModeSelect == AdvancedBankingMode)
-            {
-                // For large ROMs this area can be banked, to make sure we address
-                // the right bank we need to use the secondary bits bank which represents
-                // the top 2 bits, hence the bit shift.
-                // This means we can access the 0x00, 0x20, 0x40 and 0x60 banks
-                // for a regular MBC1 and 0x00, 0x10, 0x20, and 0x30 for MCB1M cartridges
-                selectedBank = secondarySelectedBankRegister << bankRegisterBitCount;
-            }
-
-            if (selectedBank >= rom->GetRomBankCount())
+            if (romBank0 == nullptr)
             {
                 LOG_DEBUG(ROM_BANK_INVALID);
                 return OpenBusValue;
             }
 
-            return rom->ReadFromBank(selectedBank, address);
+            return romBank0[address - RomAddressStart];
         }
         else if (address >= RomBankedAddressStart && address <= RomBankedAddressEnd)
         {
-            // Depending on the amount of banks of the cartridge we dont have to use the entire
-            // register to get the selected bank e.g: a 256 KiB cart only needs a 4-bit bank number
-            // to address all of its 16 banks, so this register is masked to 4 bits.
-            // The upper bit would be ignored for bank selection. 
-            uint8_t selectedBank = selectedBankRegister & RomBankMask();
-
-            // If the main 5-bit ROM banking register is 0, it reads the bank as if it was set to 1.
-            // MBC1M carts or smaller ROM cartridges still use the full 5 bits for this comparison as well.
-            // The comparison is done on the full 5 bit register for both MBC1M carts or smaller ROM cartridges.
-            // This means it is still possible to address bank 0 for cartridges that contain a 256 KiB or smaller ROM.
-            if ((selectedBankRegister & 0b00011111) == 0x00)
-                selectedBank += 1;
-
-            if (rom->GetRomBankCount() >= AmountOfBanksToBeLargeRom && bankingModeSelect == AdvancedBankingMode)
+            if (romBankN == nullptr)
             {
-                selectedBank |= secondarySelectedBankRegister << bankRegisterBitCount;
+                LOG_DEBUG(ROM_BANK_INVALID);
+                return OpenBusValue;
             }
 
-            return rom->ReadFromBank(selectedBank, address - RomBankedAddressStart);
+            return romBankN[address - RomBankedAddressStart];
         }
         else if (address >= RamBankedAddressStart && address <= RamBankedAddressEnd)
         {
-            if (ramEnabled)
+            if (ramBank != nullptr)
             {
-                uint8_t selectedBank = 0;
-                // The available amount of RAM banks on a MBC1 cartridge ranges from
-                // 1 bank to 4 banks (8KiB to 4 banks of 8KiB resulting in 32KiB). 
-                if (rom->GetRamBankCount() > 1)
-                    selectedBank = secondarySelectedBankRegister;
-                return ramBanks[selectedBank][address - RamBankedAddressStart];
+                return ramBank[address - RamBankedAddressStart];
             }
-            LOG_DEBUG(READ_RAM_DISABLED);
+            LOG_DEBUG(ramEnabled ? RAM_BANK_INVALID : READ_RAM_DISABLED);
             // If the cartridge has not enabled RAM writes are ignored and reads return
             // an open bus value, often being 0xFF but not guaranteed.
             return OpenBusValue;
@@ -193,31 +247,32 @@ namespace GameBoy
                 ramEnabled = true;
             else
                 ramEnabled = false;
+            UpdateBanks();
         }
         else if (address >= RomBankNumberAddressStart && address <= RomBankNumberAddressEnd)
         {
             selectedBankRegister = value;
+            UpdateBanks();
         }
         else if (address >= RamBankNumberAddressStart && address <= RamBankNumberAddressEnd)
         {
             secondarySelectedBankRegister = value & SecondarySelectedBankRegisterMask;
+            UpdateBanks();
         }
         else if (address >= BankingModeAddressStart && address <= BankingModeAddressEnd)
         {
             bankingModeSelect = value & BankingModeSelectMask;
+            UpdateBanks();
         }
         else if (address >= RamBankedAddressStart && address <= RamBankedAddressEnd)
         {
-            if (!ramEnabled)
+            if (ramBank == nullptr)
             {
-                LOG_DEBUG(WRITE_RAM_DISABLED);
+                LOG_DEBUG(ramEnabled ? RAM_BANK_INVALID : WRITE_RAM_DISABLED);
                 return ;
             }
 
-            if (rom->GetRamBankCount() > 1 && bankingModeSelect == AdvancedBankingMode)
-                ramBanks[secondarySelectedBankRegister][address - RamBankedAddressStart] = value;
-            else
-                ramBanks[0][address - RamBankedAddressStart] = value;
+            WriteRamBank(address - RamBankedAddressStart, value);
         }
         else
         {
@@ -225,4 +280,26 @@ namespace GameBoy
             assert(false);
         }
     }
+
+    const uint8_t* MBC1Cartridge::GetReadPointer(const uint16_t address)
+    {
+        if (address >= RomAddressStart && address <= RomAddressEnd)
+        {
+            return romBank0 ? romBank0 + (address - RomAddressStart) : nullptr;
+        }
+        else if (address >= RomBankedAddressStart && address <= RomBankedAddressEnd)
+        {
+            return romBankN ? romBankN + (address - RomBankedAddressStart) : nullptr;
+        }
+
+        return GetWritePointer(address);
+    }
+
+    uint8_t* MBC1Cartridge::GetWritePointer(const uint16_t address)
+    {
+        if (address < RamBankedAddressStart || address > RamBankedAddressEnd || ramBank == nullptr)
+            return nullptr;
+
+        return ramBank + (address - RamBankedAddressStart);
+    }
 }
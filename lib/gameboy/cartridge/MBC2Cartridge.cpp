@@ -44,41 +44,72 @@ static constexpr uint8_t  RamEnabledValue = 0x0A;
 
 namespace GameBoy {
 
-    MBC2Cartridge::MBC2Cartridge(std::unique_ptr<Rom> rom) : ACartridge(std::move(rom))
+    MBC2Cartridge::MBC2Cartridge(std::shared_ptr<const Rom> rom, std::filesystem::path filePath) : ACartridge(std::move(rom), std::move(filePath))
     {
+        // The MCB2 Cartridge does not contain external RAM, rather is has 512 half-bytes
+        // of ram baked into the MCB2 chip. The upper 4 bits of this RAM are undefined
+        // and should not be relied upon.
+        ramBanks = MemoryBanks(1, MBC2RamSize);
+        ramDirtyPages = DirtyPages(ramBanks.SizeInBytes());
         ramEnabled = DefaultRamEnabled;
         romBankNumber = DefaultRomBankNumber;
+        UpdateBanks();
+    }
+
+    void    MBC2Cartridge::UpdateBanks()
+    {
+        romBank0 = rom->GetBankData(0);
+        romBankN = romBankNumber < rom->GetRomBankCount() ? rom->GetBankData(romBankNumber) : nullptr;
+        ramBank = ramEnabled ? ramBanks.data() : nullptr;
+    }
+
+    void    MBC2Cartridge::SaveRegisters(SaveStateWriter& writer) const
+    {
+        writer.Write(romBankNumber);
+        writer.Write(ramEnabled);
+    }
+
+    void    MBC2Cartridge::LoadRegisters(SaveStateReader& reader) noexcept(false)
+    {
+        reader.Read(romBankNumber);
+        ramEnabled = reader.ReadBool();
+    }
+
+    void    MBC2Cartridge::ValidateRegisters(SaveStateReader& reader) const noexcept(false)
+    {
+        reader.Skip(sizeof(romBankNumber));
+        reader.ReadBool();
     }
 
     uint8_t MBC2Cartridge::ReadByte(const uint16_t address)
     {
         if (address >= RomBank00Start && address <= RomBank00End)
         {
-            return rom->ReadFromBank(0, address);
+            return romBank0[address - RomBank00Start];
         }
         else if (address >= RomBankedStart && address <= RomBankedEnd)
         {
-            if (romBankNumber >= rom->GetRomBankCount())
+            if (romBankN == nullptr)
             {
                 LOG_DEBUG(ROM_BANK_INVALID);
                 return OpenBusValue;
             }
 
-            return rom->ReadFromBank(romBankNumber, address - RomBankedStart);
+            return romBankN[address - RomBankedStart];
         }
         else if (address >= RamStart && address <= RamEnd)
         {
-            if (!ramEnabled)
+            if (ramBank == nullptr)
             {
                 LOG_DEBUG(READ_RAM_DISABLED);
                 return OpenBusValue;
             }
 
-            return ram[address - RamStart];
+            return ramBank[address - RamStart];
         }
         else if (address >= RamEchoesStart && address <= RamEchoesEnd)
         {
-            if (!ramEnabled)
+            if (ramBank == nullptr)
             {
                 LOG_DEBUG(READ_RAM_DISABLED);
                 return OpenBusValue;
@@ -87,7 +118,7 @@ namespace GameBoy {
             // Only the bottom 9 bits of the address are used here, meaning the
             // access repeats aka 'echoes'.
             LOG_DEBUG("Cartridge: Reading from MBC2's 'echoed' ram");
-            return ram[address & Lower9BitsMask];
+            return ramBank[address & Lower9BitsMask];
         }
 
         LOG_DEBUG(READ_OUT_OF_RANGE);
@@ -117,20 +148,21 @@ namespace GameBoy {
                 // Any other value will disable it.
                 ramEnabled = ((value & Lower4BitsMask) == RamEnabledValue);
             }
+            UpdateBanks();
         }
         else if (address >= RamStart && address <= RamEnd)
         {
-            if (!ramEnabled)
+            if (ramBank == nullptr)
             {
                 LOG_DEBUG(WRITE_RAM_DISABLED);
                 return ;
             }
 
-            ram[address - RamStart] = value;
+            WriteRamBank(address - RamStart, value);
         }
         else if (address >= RamEchoesStart && address <= RamEchoesEnd)
         {
-            if (!ramEnabled)
+            if (ramBank == nullptr)
             {
                 LOG_DEBUG(WRITE_RAM_DISABLED);
                 return ;
@@ -139,7 +171,7 @@ namespace GameBoy {
             // Only the bottom 9 bits of the address are used here, meaning the
             // access repeats aka 'echoes'.
             LOG_DEBUG("Cartridge: Writing to MBC2's 'echoed' ram");
-            ram[address & Lower9BitsMask] = value;
+            WriteRamBank(address & Lower9BitsMask, value);
         }
         else
         {
@@ -148,5 +180,27 @@ namespace GameBoy {
         }
     }
 
-}
+    const uint8_t*  MBC2Cartridge::GetReadPointer(const uint16_t address)
+    {
+        if (address >= RomBank00Start && address <= RomBank00End)
+        {
+            return romBank0 + (address - RomBank00Start);
+        }
+        else if (address >= RomBankedStart && address <= RomBankedEnd)
+        {
+            return romBankN ? romBankN + (address - RomBankedStart) : nullptr;
+        }
 
+        return GetWritePointer(address);
+    }
+
+    uint8_t*    MBC2Cartridge::GetWritePointer(const uint16_t address)
+    {
+        if (address < RamStart || address > RamEchoesEnd || ramBank == nullptr)
+            return nullptr;
+
+        // Both the ram and its echoes only use the bottom 9 bits of the address.
+        return ramBank + (address & Lower9BitsMask);
+    }
+
+}
@@ -61,7 +61,7 @@ static constexpr uint8_t EnableRamAndTimerValue = 0x0A;
 
 namespace GameBoy {
 
-    MBC3Cartridge::MBC3Cartridge(std::unique_ptr<Rom> rom) : ACartridge(std::move(rom))
+    MBC3Cartridge::MBC3Cartridge(std::shared_ptr<const Rom> rom, std::filesystem::path filePath) : ACartridge(std::move(rom), std::move(filePath))
     {
         /*     Control Registers     */
         ramAndTimerEnabled = DefaultRamAndTimerEnabled;
@@ -73,6 +73,42 @@ namespace GameBoy {
         const CartridgeType cType = GetType();
         if (cType == CartridgeType::MBC3_TIMER_BATTERY || cType == CartridgeType::MBC3_TIMER_RAM_BATTERY)
             hasRTC = true;
+        UpdateBanks();
+    }
+
+    void    MBC3Cartridge::UpdateBanks()
+    {
+        // The RTC registers are not backed by memory, those always go through ReadByte and WriteByte.
+        const bool ramSelected = ramAndTimerEnabled && ramOrTimerSelect <= RamBankSelectEnd && ramOrTimerSelect < GetRamBankCount();
+
+        romBank0 = rom->GetBankData(0);
+        romBankN = romBankNumber < rom->GetRomBankCount() ? rom->GetBankData(romBankNumber) : nullptr;
+        ramBank = ramSelected ? ramBanks[ramOrTimerSelect].data() : nullptr;
+    }
+
+    void    MBC3Cartridge::SaveRegisters(SaveStateWriter& writer) const
+    {
+        writer.Write(romBankNumber);
+        writer.Write(ramOrTimerSelect);
+        writer.Write(latchClockData);
+        writer.Write(ramAndTimerEnabled);
+        RTC.SaveState(writer);
+    }
+
+    void    MBC3Cartridge::LoadRegisters(SaveStateReader& reader) noexcept(false)
+    {
+        reader.Read(romBankNumber);
+        reader.Read(ramOrTimerSelect);
+        reader.Read(latchClockData);
+        ramAndTimerEnabled = reader.ReadBool();
+        RTC.LoadState(reader);
+    }
+
+    void    MBC3Cartridge::ValidateRegisters(SaveStateReader& reader) const noexcept(false)
+    {
+        reader.Skip(sizeof(romBankNumber) + sizeof(ramOrTimerSelect) + sizeof(latchClockData));
+        reader.ReadBool();
+        RTC.ValidateState(reader);
     }
 
     uint8_t MBC3Cartridge::ReadRAM(const uint16_t address)
@@ -83,14 +119,14 @@ namespace GameBoy {
             return OpenBusValue;
         }
 
-        if (ramOrTimerSelect >= GetRamBankCount())
+        if (ramBank == nullptr)
         {
             LOG_DEBUG(RAM_BANK_INVALID);
             return OpenBusValue;
         }
 
-        // The ramOrTimerSelect register specifies which bank to read from.
-        return ramBanks[ramOrTimerSelect][address - RamBankOrTimerStart];
+        // The ramOrTimerSelect register specifies which bank is mapped.
+        return ramBank[address - RamBankOrTimerStart];
     }
 
     uint8_t MBC3Cartridge::ReadRTC()
@@ -119,17 +155,17 @@ namespace GameBoy {
     {
         if (address >= RomBank00Start && address <= RomBank00End)
         {
-            return rom->ReadFromBank(0, address);
+            return romBank0[address - RomBank00Start];
         }
         else if (address >= RomBankedStart && address <= RomBankedEnd)
         {
-            if (romBankNumber >= rom->GetRomBankCount())
+            if (romBankN == nullptr)
             {
                 LOG_DEBUG(ROM_BANK_INVALID);
                 return OpenBusValue;
             }
 
-            return rom->ReadFromBank(romBankNumber, address - RomBankedStart);
+            return romBankN[address - RomBankedStart];
         }
         else if (address >= RamBankOrTimerStart && address <= RamBankOrTimerEnd)
         {
@@ -162,14 +198,14 @@ namespace GameBoy {
             return ;
         }
 
-        if (ramOrTimerSelect >= GetRamBankCount())
+        if (ramBank == nullptr)
         {
             LOG_DEBUG(RAM_BANK_INVALID);
             return ;
         }
 
-        // The ramOrTimerSelect register specifies which bank to write to.
-        ramBanks[ramOrTimerSelect][address - RamBankOrTimerStart] = value;
+        // The ramOrTimerSelect register specifies which bank is mapped.
+        WriteRamBank(address - RamBankOrTimerStart, value);
     }
 
     void    MBC3Cartridge::WriteRTC(const uint8_t value)
@@ -200,6 +236,7 @@ namespace GameBoy {
         if (address >= TimerRegistersStart && address <= TimerRegistersEnd)
         {
             ramAndTimerEnabled = ((value & EnableRamAndTimerMask) == EnableRamAndTimerValue);
+            UpdateBanks();
         }
         else if (address >= RomBankNumberStart && address <= RomBankNumberEnd)
         {
@@ -208,10 +245,12 @@ namespace GameBoy {
             romBankNumber = value & RomBankNumberMask;
             if (romBankNumber == 00)
                 romBankNumber = 01;
+            UpdateBanks();
         }
         else if (address >= RamBankNumberOrTimerSelectStart && address <= RamBankNumberOrTimerSelectEnd)
         {
             ramOrTimerSelect = value;
+            UpdateBanks();
         }
         else if (address >= LatchClockDataStart && address <= LatchClockDataEnd)
         {
@@ -240,4 +279,26 @@ namespace GameBoy {
             LOG_DEBUG(WRITE_OUT_OF_RANGE);
     }
 
+    const uint8_t*  MBC3Cartridge::GetReadPointer(const uint16_t address)
+    {
+        if (address >= RomBank00Start && address <= RomBank00End)
+        {
+            return romBank0 + (address - RomBank00Start);
+        }
+        else if (address >= RomBankedStart && address <= RomBankedEnd)
+        {
+            return romBankN ? romBankN + (address - RomBankedStart) : nullptr;
+        }
+
+        return GetWritePointer(address);
+    }
+
+    uint8_t*    MBC3Cartridge::GetWritePointer(const uint16_t address)
+    {
+        if (address < RamBankOrTimerStart || address > RamBankOrTimerEnd || ramBank == nullptr)
+            return nullptr;
+
+        return ramBank + (address - RamBankOrTimerStart);
+    }
+
 }
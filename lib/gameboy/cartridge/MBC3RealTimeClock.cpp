@@ -214,4 +214,43 @@ bool MBC3Cartridge::RealTimeClock::IsHalted() const
     return daysUpperAndFlagsInternal & HaltMask;
 }
 
+void MBC3Cartridge::RealTimeClock::SaveState(SaveStateWriter& writer) const
+{
+    writer.Write(static_cast<int64_t>(lastUpdateTime));
+    writer.Write(secondsInternal);
+    writer.Write(minutesInternal);
+    writer.Write(hoursInternal);
+    writer.Write(daysLowerInternal);
+    writer.Write(daysUpperAndFlagsInternal);
+    writer.Write(secondsLatched);
+    writer.Write(minutesLatched);
+    writer.Write(hoursLatched);
+    writer.Write(daysLowerLatched);
+    writer.Write(daysUpperAndFlagsLatched);
+}
+
+void MBC3Cartridge::RealTimeClock::LoadState(SaveStateReader& reader) noexcept(false)
+{
+    lastUpdateTime = static_cast<time_t>(reader.Read<int64_t>());
+    reader.Read(secondsInternal);
+    reader.Read(minutesInternal);
+    reader.Read(hoursInternal);
+    reader.Read(daysLowerInternal);
+    reader.Read(daysUpperAndFlagsInternal);
+    reader.Read(secondsLatched);
+    reader.Read(minutesLatched);
+    reader.Read(hoursLatched);
+    reader.Read(daysLowerLatched);
+    reader.Read(daysUpperAndFlagsLatched);
+}
+
+void MBC3Cartridge::RealTimeClock::ValidateState(SaveStateReader& reader) const noexcept(false)
+{
+    reader.Skip(sizeof(int64_t) +
+                sizeof(secondsInternal) + sizeof(minutesInternal) + sizeof(hoursInternal) +
+                sizeof(daysLowerInternal) + sizeof(daysUpperAndFlagsInternal) +
+                sizeof(secondsLatched) + sizeof(minutesLatched) + sizeof(hoursLatched) +
+                sizeof(daysLowerLatched) + sizeof(daysUpperAndFlagsLatched));
+}
+
 }
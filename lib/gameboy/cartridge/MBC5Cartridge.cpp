@@ -55,7 +55,7 @@ static constexpr uint8_t    RamEnableValue = 0x0A;
 namespace GameBoy
 {
 
-    MBC5Cartridge::MBC5Cartridge(std::unique_ptr<Rom> rom) : ACartridge(std::move(rom))
+    MBC5Cartridge::MBC5Cartridge(std::shared_ptr<const Rom> rom, std::filesystem::path filePath) : ACartridge(std::move(rom), std::move(filePath))
     {
         romBankNumberLowerbits = DefaultRomBankNumberLower;
         romBankNumberUpperbit = DefaultRomBankNumberUpper;
@@ -71,6 +71,38 @@ namespace GameBoy
 
         if (hasRumbleMotor)
             LOG_WARNING("Cartridge: Detected a cartridge with a rumble pack which is currently not implemented");
+        UpdateBanks();
+    }
+
+    void    MBC5Cartridge::UpdateBanks()
+    {
+        const uint16_t bank = (romBankNumberUpperbit << 8) | romBankNumberLowerbits;
+
+        romBank0 = rom->GetBankData(0);
+        romBankN = bank < rom->GetRomBankCount() ? rom->GetBankData(bank) : nullptr;
+        ramBank = ramEnabled && ramBankNumber < GetRamBankCount() ? ramBanks[ramBankNumber].data() : nullptr;
+    }
+
+    void    MBC5Cartridge::SaveRegisters(SaveStateWriter& writer) const
+    {
+        writer.Write(romBankNumberLowerbits);
+        writer.Write(romBankNumberUpperbit);
+        writer.Write(ramBankNumber);
+        writer.Write(ramEnabled);
+    }
+
+    void    MBC5Cartridge::LoadRegisters(SaveStateReader& reader) noexcept(false)
+    {
+        reader.Read(romBankNumberLowerbits);
+        reader.Read(romBankNumberUpperbit);
+        reader.Read(ramBankNumber);
+        ramEnabled = reader.ReadBool();
+    }
+
+    void    MBC5Cartridge::ValidateRegisters(SaveStateReader& reader) const noexcept(false)
+    {
+        reader.Skip(sizeof(romBankNumberLowerbits) + sizeof(romBankNumberUpperbit) + sizeof(ramBankNumber));
+        reader.ReadBool();
     }
 
     void    MBC5Cartridge::ActivateRumbleMotor()
@@ -89,29 +121,27 @@ namespace GameBoy
     {
         if (address >= RomBank00RangeStart && address <= RomBank00RangeEnd)
         {
-            return rom->ReadFromBank(0, address);
+            return romBank0[address - RomBank00RangeStart];
         }
         else if (address >= RomBankedRangeStart && address <= RomBankedRangeEnd)
         {
-            uint16_t bank = (romBankNumberUpperbit << 8) | romBankNumberLowerbits;
-
-            if (bank >= rom->GetRomBankCount())
+            if (romBankN == nullptr)
             {
                 LOG_DEBUG(ROM_BANK_INVALID);
                 return OpenBusValue;
             }
 
-            return rom->ReadFromBank(bank, address - RomBankedRangeStart);
+            return romBankN[address - RomBankedRangeStart];
         }
         else if (address >= RamBankedRangeStart && address <= RamBankedRangeEnd)
         {
-            if (!ramEnabled)
+            if (ramBank == nullptr)
             {
-                LOG_DEBUG(READ_RAM_DISABLED);
+                LOG_DEBUG(ramEnabled ? RAM_BANK_INVALID : READ_RAM_DISABLED);
                 return OpenBusValue;
             }
 
-            return ramBanks[ramBankNumber][address - RamBankedRangeStart];
+            return ramBank[address - RamBankedRangeStart];
         }
 
         LOG_DEBUG(READ_OUT_OF_RANGE);
@@ -124,18 +154,22 @@ namespace GameBoy
         {
             // Writing a value with 0x0A in its lower 4 bits will enable the RAM. 
             ramEnabled = (value & RamEnableMask) == RamEnableValue;
+            UpdateBanks();
         }
         else if (address >= RomBankNumberLowerRangeStart && address <= RomBankNumberLowerRangeEnd)
         {
             romBankNumberLowerbits = value;
+            UpdateBanks();
         }
         else if (address >= RomBankNumberUpperRangeStart && address <= RomBankNumberUpperRangeEnd)
         {
             romBankNumberUpperbit = value & RomBankNumberUpperMask;
+            UpdateBanks();
         }
         else if (address >= RamBankNumberRangeStart && address <= RamBankNumberRangeEnd)
         {
             ramBankNumber = value;
+            UpdateBanks();
 
             // If the cartridge has a rumble pack, the 3rd bit is used to (de)activate the motor.
             if (hasRumbleMotor)
@@ -148,19 +182,13 @@ namespace GameBoy
         }
         else if (address >= RamBankedRangeStart && address <= RamBankedRangeEnd)
         {
-            if (!ramEnabled)
-            {
-                LOG_DEBUG(WRITE_RAM_DISABLED);
-                return ;
-            }
-
-            if (ramBankNumber >= GetRamBankCount())
+            if (ramBank == nullptr)
             {
-                LOG_DEBUG(RAM_BANK_INVALID);
+                LOG_DEBUG(ramEnabled ? RAM_BANK_INVALID : WRITE_RAM_DISABLED);
                 return ;
             }
 
-            ramBanks[ramBankNumber][address - RamBankedRangeStart] = value;
+            WriteRamBank(address - RamBankedRangeStart, value);
         }
         else
         {
@@ -168,4 +196,26 @@ namespace GameBoy
         }
     }
 
+    const uint8_t*  MBC5Cartridge::GetReadPointer(const uint16_t address)
+    {
+        if (address >= RomBank00RangeStart && address <= RomBank00RangeEnd)
+        {
+            return romBank0 + (address - RomBank00RangeStart);
+        }
+        else if (address >= RomBankedRangeStart && address <= RomBankedRangeEnd)
+        {
+            return romBankN ? romBankN + (address - RomBankedRangeStart) : nullptr;
+        }
+
+        return GetWritePointer(address);
+    }
+
+    uint8_t*    MBC5Cartridge::GetWritePointer(const uint16_t address)
+    {
+        if (address < RamBankedRangeStart || address > RamBankedRangeEnd || ramBank == nullptr)
+            return nullptr;
+
+        return ramBank + (address - RamBankedRangeStart);
+    }
+
 }
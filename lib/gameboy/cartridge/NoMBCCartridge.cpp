@@ -27,15 +27,38 @@ static constexpr uint16_t RamAddressRangeEnd = 0xBFFF;
 
 namespace GameBoy {
 
-    NoMBCCartridge::NoMBCCartridge(std::unique_ptr<Rom> rom) : ACartridge(std::move(rom))
+    NoMBCCartridge::NoMBCCartridge(std::shared_ptr<const Rom> rom, std::filesystem::path filePath) : ACartridge(std::move(rom), std::move(filePath))
     {
         CartridgeType cType = GetType();
 
         hasRam = false;
         if (cType == CartridgeType::ROM_RAM || cType == CartridgeType::ROM_RAM_BATTERY)
             hasRam = true;
+        UpdateBanks();
     }
 
+    void    NoMBCCartridge::UpdateBanks()
+    {
+        romBank0 = rom->GetBankData(0);
+        romBankN = rom->GetRomBankCount() > 1 ? rom->GetBankData(1) : nullptr;
+        ramBank = hasRam && ramBanks.size() > 0 ? ramBanks[0].data() : nullptr;
+    }
+
+    void    NoMBCCartridge::SaveRegisters(SaveStateWriter& writer) const
+    {
+        // There are no control registers, the ROM and RAM are always mapped.
+        (void)writer;
+    }
+
+    void    NoMBCCartridge::LoadRegisters(SaveStateReader& reader) noexcept(false)
+    {
+        (void)reader;
+    }
+
+    void    NoMBCCartridge::ValidateRegisters(SaveStateReader& reader) const noexcept(false)
+    {
+        (void)reader;
+    }
 
     uint8_t NoMBCCartridge::ReadByte(const uint16_t address)
     {
@@ -46,17 +69,17 @@ namespace GameBoy {
             // check if we need to address another bank or not.
             if (address >= RomBankSize)
             {
-                if (rom->GetRomBankCount() == 1)
+                if (romBankN == nullptr)
                 {
                     LOG_DEBUG(READ_OUT_OF_RANGE);
                     return OpenBusValue;
                 }
 
-                return rom->ReadFromBank(1, address - RomBankSize);
+                return romBankN[address - RomBankSize];
             }
 
             // The address falls within bank 0's range.
-            return rom->ReadFromBank(0, address);
+            return romBank0[address];
         }
         else if (address >= RamAddressRangeStart && address <= RamAddressRangeEnd)
         {
@@ -72,7 +95,7 @@ namespace GameBoy {
                 return OpenBusValue;
             }
 
-            return ramBanks[0][address - RamAddressRangeStart];
+            return ramBank[address - RamAddressRangeStart];
         }
         else
         {
@@ -99,7 +122,7 @@ namespace GameBoy {
         // This cartridge type only supports one bank of 8 KiB.
         if (address >= RamAddressRangeStart && address <= RamAddressRangeEnd)
         {
-            ramBanks[0][address - RamAddressRangeStart] = value;
+            WriteRamBank(address - RamAddressRangeStart, value);
         }
         else
         {
@@ -107,4 +130,27 @@ namespace GameBoy {
         }
     }
 
+    const uint8_t*  NoMBCCartridge::GetReadPointer(const uint16_t address)
+    {
+        if (address >= RomAddressRangeStart && address <= RomAddressRangeEnd)
+        {
+            const uint8_t* bank = address < RomBankSize ? romBank0 : romBankN;
+
+            return bank ? bank + (address % RomBankSize) : nullptr;
+        }
+
+        return GetWritePointer(address);
+    }
+
+    uint8_t*    NoMBCCartridge::GetWritePointer(const uint16_t address)
+    {
+        if (address < RamAddressRangeStart || address > RamAddressRangeEnd)
+            return nullptr;
+
+        if (ramBank == nullptr)
+            return nullptr;
+
+        return ramBank + (address - RamAddressRangeStart);
+    }
+
 }
@@ -18,6 +18,8 @@
 #include <play-man/gameboy/cartridge/Rom.hpp>
 #include <play-man/utility/UtilFunc.hpp>
 #include <string_view>
+#include <algorithm>
+#include <cstring>
 #include <sstream>
 #include <iostream>
 #include <iomanip>
@@ -80,7 +82,7 @@ namespace GameBoy {
 
     /*     RomHeader     */
 
-    void RomHeader::Init(const std::vector<uint8_t>& data)
+    void RomHeader::Init(std::span<const uint8_t> data)
     {
         assert(data.size() >= romHeaderSize);
         title.fill('\0');
@@ -162,63 +164,66 @@ namespace GameBoy {
 
     /*     Rom     */
 
-    Rom::Rom(const char* romFilePath) noexcept(false)
+    Rom::Rom(const char* romFilePath) noexcept(false) : Rom(romFilePath, OpenFile(romFilePath))
     {
-        filePath = romFilePath;
-        std::ifstream rom(filePath);
-    
-        if (!rom.good())
-        {
-            std::string error;
+    }
 
-            error += "Failed to open ROM: ";
-            error += filePath;
-            error += "\nError: " + Utility::ErrnoToString() + "\n";
-            throw std::runtime_error(error); 
-        }
+    Rom::Rom(const char* romFilePath, Utility::MappedFile&& romImage) : filePath(romFilePath), image(std::move(romImage))
+    {
+        header.Init(std::span<const uint8_t>(image.data(), image.size()));
+        InitRomBanks();
+    }
 
-        std::streamsize romSize = std::filesystem::file_size(filePath);
-        std::vector<uint8_t> rawRomData;
+    Rom::Rom(const Rom& other) : header(other.header), filePath(other.filePath)
+    {
+        romBanks = MemoryBanks(other.romDataBankCount, RomBankSize);
+        if (romBanks.SizeInBytes() > 0)
+            std::memcpy(romBanks.data(), other.romData, romBanks.SizeInBytes());
 
-        rawRomData.resize(romSize);
-        rom.read(reinterpret_cast<char*>(rawRomData.data()), romSize);
-        rom.close();
+        romData = romBanks.data();
+        romDataBankCount = other.romDataBankCount;
+    }
 
-        header.Init(rawRomData);
-        InitRomBanks(rawRomData);
+    Utility::MappedFile Rom::OpenFile(const char* romFilePath) noexcept(false)
+    {
+        try
+        {
+            return Utility::MappedFile(romFilePath);
+        }
+        catch (const std::runtime_error& e)
+        {
+            throw std::runtime_error(std::string("Failed to open ROM: ") + romFilePath + "\n" + e.what());
+        }
     }
 
-    /**
-     * @brief Copies the given raw data into the correct rom bank
-     * 
-     * @param rawRomData The full data inside the ROM
-     * @param romBank The bank needing to be filled
-     * @param bankNumber The number of the bank being filled
-     */
-    static void CopyRomBankData(const std::vector<uint8_t>& rawRomData, std::vector<uint8_t>& romBank, uint32_t bankNumber)
+    void    Rom::InitRomBanks()
     {
-        uint32_t    currentBankStart = bankNumber * RomBankSize;
-        uint32_t    currentBankEnd = (bankNumber + 1) * RomBankSize;
+        const uint32_t bankCount = GetRomBankCount();
 
-        if (currentBankStart > rawRomData.size())
+        // Regular ROM files contain exactly the banks stated in their header,
+        // in which case the banks are read straight from the mapped file.
+        if (image.size() >= static_cast<size_t>(bankCount) * RomBankSize)
+        {
+            romData = image.data();
+            romDataBankCount = bankCount;
             return ;
+        }
 
-        if (currentBankEnd > rawRomData.size())
-            currentBankEnd = rawRomData.size();
-        
-        romBank.insert(romBank.begin(), rawRomData.begin() + currentBankStart, rawRomData.begin() + currentBankEnd);
+        CopyImageToBanks(bankCount);
     }
-    
-    void    Rom::InitRomBanks(std::vector<uint8_t>& rawRomData)
+
+    void    Rom::CopyImageToBanks(uint32_t bankCount)
     {
-        uint32_t romBankCount = GetRomBankCount();
-        
-        romBanks.resize(romBankCount);
-        for (uint32_t i = 0; i < romBankCount; i++)
-        {
-            romBanks[i].resize(RomBankSize);
-            CopyRomBankData(rawRomData, romBanks[i], i);
-        }
+        romBanks = MemoryBanks(bankCount, RomBankSize);
+
+        // Any banks not (fully) covered by the file stay zero initialized.
+        const size_t bytesToCopy = std::min(image.size(), romBanks.SizeInBytes());
+        if (bytesToCopy > 0)
+            std::memcpy(romBanks.data(), image.data(), bytesToCopy);
+
+        romData = romBanks.data();
+        romDataBankCount = bankCount;
+        image = Utility::MappedFile();
     }
 
     const RomHeader& Rom::GetHeader() const
@@ -226,12 +231,12 @@ namespace GameBoy {
         return header;
     }
 
-    const MemoryBanks& Rom::GetBanks() const
+    std::span<const uint8_t> Rom::GetData() const
     {
-        return romBanks;
+        return std::span<const uint8_t>(romData, static_cast<size_t>(romDataBankCount) * RomBankSize);
     }
 
-    const char* Rom::GetFilePath() const
+    const std::filesystem::path& Rom::GetFilePath() const
     {
         return filePath;
     }
@@ -289,9 +294,15 @@ namespace GameBoy {
 
     uint8_t Rom::ReadFromBank(uint32_t bank, uint16_t address) const
     {
-        assert(bank < romBanks.size());
-        assert(address < romBanks[bank].size());
-        return romBanks[bank][address];
+        assert(bank < romDataBankCount);
+        assert(address < RomBankSize);
+        return romData[bank * RomBankSize + address];
+    }
+
+    const uint8_t* Rom::GetBankData(uint32_t bank) const
+    {
+        assert(bank < romDataBankCount);
+        return romData + bank * RomBankSize;
     }
 
     void    Rom::LoadTestRom(const char* filePath)
@@ -322,6 +333,10 @@ namespace GameBoy {
         header.romSize = RomSize::KiB32;
         header.ramSize = RamSize::NoRam;
 
+        // The mapped file is read only, the test data has to be written into a copy.
+        if (image.data() != nullptr && romData == image.data())
+            CopyImageToBanks(romDataBankCount);
+
         size_t totalBytesSet = 0;
         for (size_t bank = 0; bank <= static_cast<size_t>(romSize) / (4 *KiB); bank++)
         {
@@ -333,9 +348,9 @@ namespace GameBoy {
         }
     }
 
-    std::ostream& operator << (std::ostream& lhs, Rom& rom)
+    std::ostream& operator << (std::ostream& lhs, const Rom& rom)
     {
-        lhs << "Info for ROM located on: " << rom.GetFilePath() << std::endl;
+        lhs << "Info for ROM located on: " << rom.GetFilePath().string() << std::endl;
         lhs << rom.GetHeader();
         return (lhs);
     }
@@ -0,0 +1,203 @@
+// ****************************************************************************** //
+//   _______   __                              __       __                        //
+//  /       \ /  |                            /  \     /  |                       //
+//  $$$$$$$  |$$ |  ______   __    __         $$  \   /$$ |  ______   _______     //
+//  $$ |__$$ |$$ | /      \ /  |  /  | ______ $$$  \ /$$$ | /      \ /       \    //
+//  $$    $$/ $$ | $$$$$$  |$$ |  $$ |/      |$$$$  /$$$$ | $$$$$$  |$$$$$$$  |   //
+//  $$$$$$$/  $$ | /    $$ |$$ |  $$ |$$$$$$/ $$ $$ $$/$$ | /    $$ |$$ |  $$ |   //
+//  $$ |      $$ |/$$$$$$$ |$$ \__$$ |        $$ |$$$/ $$ |/$$$$$$$ |$$ |  $$ |   //
+//  $$ |      $$ |$$    $$ |$$    $$ |        $$ | $/  $$ |$$    $$ |$$ |  $$ |   //
+//  $$/       $$/  $$$$$$$/  $$$$$$$ |        $$/      $$/  $$$$$$$/ $$/   $$/    //
+//                          /  \__$$ |                                            //
+//                          $$    $$/                                             //
+//                           $$$$$$/                                              //
+//                                                                                //
+//                            By: K1ngmar and rvan-mee                            //
+// ****************************************************************************** //
+
+#include <play-man/gameboy/cartridge/RomCache.hpp>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <tuple>
+#include <unordered_map>
+
+#if defined(__linux__) || defined(__APPLE__)
+    #include <sys/stat.h>
+    #define PLAY_MAN_HAS_FILE_IDENTITY
+#endif
+
+namespace GameBoy
+{
+
+/**
+ * @brief FNV-1a over 8 byte words, only used to find candidates in the cache,
+ *        the contents are always compared on a hit.
+ */
+static uint64_t HashRomData(std::span<const uint8_t> data)
+{
+    constexpr uint64_t offsetBasis = 0xCBF29CE484222325;
+    constexpr uint64_t prime = 0x100000001B3;
+
+    uint64_t hash = offsetBasis ^ data.size();
+    size_t   i = 0;
+
+    for (; i + sizeof(uint64_t) <= data.size(); i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        std::memcpy(&word, data.data() + i, sizeof(word));
+        hash = (hash ^ word) * prime;
+    }
+    for (; i < data.size(); i++)
+        hash = (hash ^ data[i]) * prime;
+
+    return hash;
+}
+
+/**
+ * @brief Identifies a file without reading it, a changed size or modification time
+ *        means the file has to be loaded again.
+ */
+struct FileIdentity
+{
+    uint64_t    device;
+    uint64_t    inode;
+    uint64_t    size;
+    int64_t     modifiedSeconds;
+    int64_t     modifiedNanoseconds;
+
+    bool operator < (const FileIdentity& rhs) const
+    {
+        return std::tie(device, inode, size, modifiedSeconds, modifiedNanoseconds) <
+            std::tie(rhs.device, rhs.inode, rhs.size, rhs.modifiedSeconds, rhs.modifiedNanoseconds);
+    }
+};
+
+/**
+ * @return std::nullopt if the identity of the file can not be determined,
+ *         in which case the ROM is only found by its contents.
+ */
+static std::optional<FileIdentity> GetFileIdentity(const char* filePath)
+{
+#if defined(PLAY_MAN_HAS_FILE_IDENTITY)
+    struct stat status;
+
+    if (stat(filePath, &status) != 0)
+        return std::nullopt;
+
+    #if defined(__APPLE__)
+        const timespec modified = status.st_mtimespec;
+    #else
+        const timespec modified = status.st_mtim;
+    #endif
+
+    return FileIdentity {
+        static_cast<uint64_t>(status.st_dev),
+        static_cast<uint64_t>(status.st_ino),
+        static_cast<uint64_t>(status.st_size),
+        static_cast<int64_t>(modified.tv_sec),
+        static_cast<int64_t>(modified.tv_nsec)
+    };
+#else
+    (void)filePath;
+    return std::nullopt;
+#endif
+}
+
+struct CachedRom
+{
+    std::weak_ptr<const Rom>    rom;
+    // The ROM's data can be padded, so the size of the file it was loaded from is kept separately.
+    size_t                      fileSize;
+};
+
+static std::mutex                                           romCacheMutex;
+static std::map<FileIdentity, std::weak_ptr<const Rom>>     romsByFile;
+static std::unordered_multimap<uint64_t, CachedRom>         romsByContents;
+
+/**
+ * @brief Looks up a ROM with the same contents as fileData, for copies of a ROM stored at another path.
+ * @note  Expects romCacheMutex to be locked.
+ */
+static std::shared_ptr<const Rom> FindRomByContents(uint64_t hash, std::span<const uint8_t> fileData)
+{
+    auto [it, end] = romsByContents.equal_range(hash);
+    while (it != end)
+    {
+        std::shared_ptr<const Rom> rom = it->second.rom.lock();
+        if (rom == nullptr)
+        {
+            it = romsByContents.erase(it);
+            continue ;
+        }
+
+        const auto romData = rom->GetData();
+        if (it->second.fileSize == fileData.size() && romData.size() >= fileData.size() &&
+            (fileData.empty() || std::memcmp(romData.data(), fileData.data(), fileData.size()) == 0))
+        {
+            return rom;
+        }
+        ++it;
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Drops the entries of ROMs that are no longer used by any cartridge,
+ *        otherwise a host cycling through many ROMs would keep an entry for every one of them.
+ * @note  Expects romCacheMutex to be locked.
+ */
+static void PruneExpiredRoms()
+{
+    std::erase_if(romsByFile, [](const auto& entry) { return entry.second.expired(); });
+    std::erase_if(romsByContents, [](const auto& entry) { return entry.second.rom.expired(); });
+}
+
+std::shared_ptr<const Rom> LoadSharedRom(const char* filePath) noexcept(false)
+{
+    // A file that was loaded before is found without opening or reading it.
+    const std::optional<FileIdentity> identity = GetFileIdentity(filePath);
+    if (identity.has_value())
+    {
+        std::lock_guard<std::mutex> lock(romCacheMutex);
+
+        const auto it = romsByFile.find(*identity);
+        if (it != romsByFile.end())
+        {
+            if (std::shared_ptr<const Rom> rom = it->second.lock())
+                return rom;
+            romsByFile.erase(it);
+        }
+    }
+
+    Utility::MappedFile image = Rom::OpenFile(filePath);
+    const std::span<const uint8_t> fileData(image.data(), image.size());
+    const uint64_t hash = HashRomData(fileData);
+
+    std::lock_guard<std::mutex> lock(romCacheMutex);
+
+    PruneExpiredRoms(); // Only reached for files that are not cached yet, so not on every load.
+
+    std::shared_ptr<const Rom> rom = FindRomByContents(hash, fileData);
+    if (rom == nullptr)
+    {
+        const size_t fileSize = fileData.size();
+        rom = std::make_shared<const Rom>(filePath, std::move(image));
+        romsByContents.emplace(hash, CachedRom { rom, fileSize });
+    }
+
+    if (identity.has_value())
+        romsByFile.insert_or_assign(*identity, rom);
+    return rom;
+}
+
+size_t GetRomCacheSize()
+{
+    std::lock_guard<std::mutex> lock(romCacheMutex);
+
+    return romsByFile.size() + romsByContents.size();
+}
+
+}
@@ -0,0 +1,82 @@
+// ****************************************************************************** //
+//   _______   __                              __       __                        //
+//  /       \ /  |                            /  \     /  |                       //
+//  $$$$$$$  |$$ |  ______   __    __         $$  \   /$$ |  ______   _______     //
+//  $$ |__$$ |$$ | /      \ /  |  /  | ______ $$$  \ /$$$ | /      \ /       \    //
+//  $$    $$/ $$ | $$$$$$  |$$ |  $$ |/      |$$$$  /$$$$ | $$$$$$  |$$$$$$$  |   //
+//  $$$$$$$/  $$ | /    $$ |$$ |  $$ |$$$$$$/ $$ $$ $$/$$ | /    $$ |$$ |  $$ |   //
+//  $$ |      $$ |/$$$$$$$ |$$ \__$$ |        $$ |$$$/ $$ |/$$$$$$$ |$$ |  $$ |   //
+//  $$ |      $$ |$$    $$ |$$    $$ |        $$ | $/  $$ |$$    $$ |$$ |  $$ |   //
+//  $$/       $$/  $$$$$$$/  $$$$$$$ |        $$/      $$/  $$$$$$$/ $$/   $$/    //
+//                          /  \__$$ |                                            //
+//                          $$    $$/                                             //
+//                           $$$$$$/                                              //
+//                                                                                //
+//                            By: K1ngmar and rvan-mee                            //
+// ****************************************************************************** //
+
+#include <play-man/gameboy/cpu/BlockCache.hpp>
+
+namespace GameBoy
+{
+	BlockCache::PageBlocks* BlockCache::FindPage(const uint8_t* page)
+	{
+		if (page != lastPage)
+		{
+			const auto it = pages.find(page);
+
+			lastPage = page;
+			lastPageBlocks = (it != pages.end()) ? it->second.get() : nullptr;
+		}
+		return lastPageBlocks;
+	}
+
+	DecodedBlock* BlockCache::Find(const uint8_t* page, uint8_t offset)
+	{
+		PageBlocks* blocks = FindPage(page);
+
+		if (blocks == nullptr)
+			return nullptr;
+		return blocks->blocks[offset].get();
+	}
+
+	DecodedBlock* BlockCache::Insert(const uint8_t* page, uint8_t offset, std::span<const DecodedInstruction> instructions, bool writable)
+	{
+		PageBlocks* blocks = FindPage(page);
+
+		if (blocks == nullptr)
+		{
+			auto& inserted = pages[page];
+
+			inserted = std::make_unique<PageBlocks>();
+			inserted->writable = writable;
+			lastPage = page;
+			lastPageBlocks = blocks = inserted.get();
+		}
+
+		auto block = std::make_unique<DecodedBlock>();
+
+		block->instructions.reserve(instructions.size() + 1);
+		block->instructions.assign(instructions.begin(), instructions.end());
+		block->instructions.push_back(DecodedInstruction { nullptr, 0, 0 });
+		block->writable = writable;
+
+		blocks->blocks[offset] = std::move(block);
+		return blocks->blocks[offset].get();
+	}
+
+	void BlockCache::FlushWritable()
+	{
+		std::erase_if(pages, [](const auto& page) { return page.second->writable; });
+		lastPage = nullptr;
+		lastPageBlocks = nullptr;
+	}
+
+	void BlockCache::Clear()
+	{
+		pages.clear();
+		lastPage = nullptr;
+		lastPageBlocks = nullptr;
+	}
+
+} /* namespace GameBoy */
@@ -24,17 +24,96 @@ namespace GameBoy
     void Cpu::LoadTestRom(const char* filePath)
     {
         core.ClearRegisters();
+        halted = false;
         cartridge->LoadTestRom(filePath);
+        memoryBus.MapCartridge();
+        ClearBlockCache(); // The blocks point into the replaced ROM.
+    }
+
+    void Cpu::SaveState(std::vector<uint8_t>& buffer)
+    {
+        SaveStateWriter writer(buffer);
+
+        core.MaterializeFlags();
+        writer.BeginSection(MakeSaveStateId("CPU "));
+        writer.Write(core.AF.Value());
+        writer.Write(core.BC.Value());
+        writer.Write(core.DE.Value());
+        writer.Write(core.HL.Value());
+        writer.Write(core.SP.Value());
+        writer.Write(core.PC.Value());
+        writer.Write(core.IE);
+        writer.Write(core.IF);
+        writer.Write(core.cgbMode);
+        writer.Write(halted);
+        writer.Write(static_cast<uint64_t>(cycles));
+        writer.EndSection();
+
+        scheduler.SaveState(writer);
+        timer.SaveState(writer);
+        memoryBus.SaveState(writer);
+        cartridge->SaveState(writer);
+    }
+
+    void Cpu::ValidateState(std::span<const uint8_t> data) const noexcept(false)
+    {
+        SaveStateReader reader(data);
+
+        reader.BeginSection(MakeSaveStateId("CPU "));
+        reader.Skip(6 * sizeof(uint16_t) + sizeof(core.IE) + sizeof(core.IF));
+        reader.ReadBool(); // cgbMode
+        reader.ReadBool(); // halted
+        reader.Skip(sizeof(uint64_t));
+        reader.EndSection();
+
+        scheduler.ValidateState(reader);
+        timer.ValidateState(reader);
+        memoryBus.ValidateState(reader);
+        cartridge->ValidateState(reader);
+        reader.Finish();
+    }
+
+    void Cpu::LoadState(std::span<const uint8_t> data) noexcept(false)
+    {
+        ValidateState(data); // Nothing below can throw anymore, so a rejected state leaves the machine as is.
+
+        SaveStateReader reader(data);
+
+        reader.BeginSection(MakeSaveStateId("CPU "));
+        core.AF.SetValue(reader.Read<uint16_t>());
+        core.BC.SetValue(reader.Read<uint16_t>());
+        core.DE.SetValue(reader.Read<uint16_t>());
+        core.HL.SetValue(reader.Read<uint16_t>());
+        core.SP.SetValue(reader.Read<uint16_t>());
+        core.PC.SetValue(reader.Read<uint16_t>());
+        reader.Read(core.IE);
+        reader.Read(core.IF);
+        core.cgbMode = reader.ReadBool();
+        halted = reader.ReadBool();
+        cycles = static_cast<size_t>(reader.Read<uint64_t>());
+        reader.EndSection();
+        core.lazyFlags.operation = LazyFlagOperation::None; // The saved F register is up to date.
+
+        scheduler.LoadState(reader);
+        timer.LoadState(reader);
+        memoryBus.LoadState(reader);
+        cartridge->LoadState(reader);
+
+        memoryBus.MapCartridge();
+        ClearBlockCache(); // The blocks might have been decoded from the replaced memory.
+        sliceEnd = 0;
     }
 
     void Cpu::ExecuteInstruction(OpCode opCode)
     {
         instructions[opCode](this);
+        core.MaterializeFlags();
     }
 
     void Cpu::ExecuteInstruction(PrefixedOpCode opCode)
     {
         prefixedInstructions[opCode](this);
+        core.MaterializeFlags();
     }
 
     void Cpu::LogInstruction()
@@ -53,6 +132,8 @@ namespace GameBoy
         {
             std::cout << "\nCore before instruction:\n" << core;
             cycles += currentInstruction.Execute(this);
+            core.MaterializeFlags();
+            scheduler.RunDueEvents(cycles);
             LogInstruction();
             std::cout << "Core after instruction:\n" << core;
         }
@@ -61,29 +142,6 @@ namespace GameBoy
             LOG_FATAL("Failed to execute instruction " + currentInstruction.OpCodeAsHexString() + ": " + e.what());
             abort();
         }
-
-        // TODO: handle instruction timing
-        // Take branching into account
-        // cyclesPassed += cycleTable[opcodeIsPrefixed].at(currentOpcode);
-    }
-
-	uint8_t Cpu::Fetch(uint16_t address)
-	{
-		return memoryBus.ReadByte(address);
-	}
-
-	uint8_t Cpu::FetchPcAddress()
-	{	
-		const auto data = Fetch(core.PC.Value());
-		core.PC++;
-		return data;
-	}
-
-    uint16_t Cpu::FetchPcAddress16bit()
-    {
-		const auto data = (Fetch(core.PC.Value()) << 8) | Fetch(core.PC.Value() + 1);
-		core.PC += 2;
-		return data;
     }
 
     void Cpu::FetchInstruction()
@@ -16,6 +16,7 @@
 // ****************************************************************************** //
 
 #include <play-man/gameboy/cpu/CpuCore.hpp>
+#include <play-man/gameboy/cpu/AluTables.hpp>
 #include <play-man/utility/UtilFunc.hpp>
 
 namespace GameBoy
@@ -29,6 +30,8 @@ namespace GameBoy
         SP = 0x00'00;
         PC = 0x00'00;
         IE = 0x00;
+        IF = 0x00;
+        lazyFlags = LazyFlags {};
     }
 
     uint8_t	CpuCore::GetInterruptRegister()
@@ -41,21 +44,37 @@ namespace GameBoy
         IE = value;
     }
 
-    void CpuCore::SetFlag(FlagRegisterFlag flag, bool enable)
+    uint8_t CpuCore::ComputeFlags() const
     {
-        if (enable)
-        {
-            AF.SetLowByte(AF.LowByte() | static_cast<uint8_t>(flag));
-        }
-        else
+        const auto& [operation, base, operand, result, carryIn] = lazyFlags;
+
+        switch (operation)
         {
-            AF.SetLowByte(AF.LowByte() & ~(static_cast<uint8_t>(flag)));
+            case LazyFlagOperation::None:
+                return AF.LowByte() & 0xF0;
+            // Bit 4 of base ^ operand ^ (untruncated result) is the carry out of bit 3, bit 8 the carry out of bit 7.
+            case LazyFlagOperation::Add:
+            {
+                const uint32_t carries = base ^ operand ^ (base + operand + carryIn);
+                return ((carries << 1) & AluTables::halfCarryFlag) | ((carries >> 4) & AluTables::carryFlag)
+                    | (result == 0 ? AluTables::zeroFlag : 0);
+            }
+            case LazyFlagOperation::Sub:
+            {
+                const uint32_t carries = base ^ operand ^ (base - operand - carryIn);
+                return AluTables::subFlag | ((carries << 1) & AluTables::halfCarryFlag) | ((carries >> 4) & AluTables::carryFlag)
+                    | (result == 0 ? AluTables::zeroFlag : 0);
+            }
+            case LazyFlagOperation::Increment:
+                return AluTables::incrementFlags[result] | (carryIn ? AluTables::carryFlag : 0);
+            case LazyFlagOperation::Decrement:
+                return AluTables::decrementFlags[result] | (carryIn ? AluTables::carryFlag : 0);
+            case LazyFlagOperation::And:
+                return (result == 0 ? AluTables::zeroFlag : 0) | AluTables::halfCarryFlag;
+            case LazyFlagOperation::Or:
+                return result == 0 ? AluTables::zeroFlag : 0;
         }
-    }
-
-    bool CpuCore::GetFlag(FlagRegisterFlag flag)
-    {
-        return (AF.LowByte() & static_cast<uint8_t>(flag)) > 0;
+        return AF.LowByte() & 0xF0;
     }
 
     bool CpuCore::GetCgbMode() const
@@ -81,14 +100,16 @@ namespace GameBoy
 
     std::ostream& operator << (std::ostream& lhs, const CpuCore& core)
     {
+        const uint8_t flags = (core.AF.LowByte() & 0x0F) | core.ComputeFlags();
+
         lhs << "Register:       Value:\n";
-        lhs << "AF              " << Utility::IntAsHexString(core.AF.HighByte()) << " " << Utility::IntAsHexString(core.AF.LowByte());
+        lhs << "AF              " << Utility::IntAsHexString(core.AF.HighByte()) << " " << Utility::IntAsHexString(flags);
         
         // Print the bits of the flag register
         lhs << " Flags: 0b";
         for (int8_t i = 7; i >= 0; i--)
         {
-            lhs << (((core.AF.LowByte() >> i) & 1) ? "1" : "0");
+            lhs << (((flags >> i) & 1) ? "1" : "0");
         }
         lhs << "\n";
 
@@ -98,6 +119,7 @@ namespace GameBoy
         lhs << "SP              " << Utility::IntAsHexString(core.SP.Value()) << "\n";
         lhs << "PC              " << Utility::IntAsHexString(core.PC.Value()) << "\n";
         lhs << "IE              " << Utility::IntAsHexString(core.IE) << "\n";
+        lhs << "IF              " << Utility::IntAsHexString(core.IF) << "\n";
         return lhs;
     }
 
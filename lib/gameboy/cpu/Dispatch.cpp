@@ -0,0 +1,511 @@
+// ****************************************************************************** //
+//   _______   __                              __       __                        //
+//  /       \ /  |                            /  \     /  |                       //
+//  $$$$$$$  |$$ |  ______   __    __         $$  \   /$$ |  ______   _______     //
+//  $$ |__$$ |$$ | /      \ /  |  /  | ______ $$$  \ /$$$ | /      \ /       \    //
+//  $$    $$/ $$ | $$$$$$  |$$ |  $$ |/      |$$$$  /$$$$ | $$$$$$  |$$$$$$$  |   //
+//  $$$$$$$/  $$ | /    $$ |$$ |  $$ |$$$$$$/ $$ $$ $$/$$ | /    $$ |$$ |  $$ |   //
+//  $$ |      $$ |/$$$$$$$ |$$ \__$$ |        $$ |$$$/ $$ |/$$$$$$$ |$$ |  $$ |   //
+//  $$ |      $$ |$$    $$ |$$    $$ |        $$ | $/  $$ |$$    $$ |$$ |  $$ |   //
+//  $$/       $$/  $$$$$$$/  $$$$$$$ |        $$/      $$/  $$$$$$$/ $$/   $$/    //
+//                          /  \__$$ |                                            //
+//                          $$    $$/                                             //
+//                           $$$$$$/                                              //
+//                                                                                //
+//                            By: K1ngmar and rvan-mee                            //
+// ****************************************************************************** //
+
+#include <play-man/gameboy/cpu/Cpu.hpp>
+#include <play-man/gameboy/cpu/instructions/InstructionTable.ipp>
+#include <play-man/gameboy/memory/MemoryBusDefines.hpp>
+#include <play-man/logger/Logger.hpp>
+#include <play-man/utility/UtilFunc.hpp>
+
+#include <algorithm>
+
+/**
+ * @brief Called when the fetched opcode does not have an implementation inside the instruction tables.
+ */
+[[noreturn]] static void AbortOnMissingInstruction(uint16_t opCode)
+{
+	LOG_FATAL("Unable to fetch instruction: no instruction found for opcode: " + Utility::IntAsHexString(opCode));
+	abort();
+}
+
+namespace GameBoy
+{
+	size_t Cpu::FetchAndExecute()
+	{
+		const uint8_t opCode = FetchPcAddress();
+		InstructionPrototype instruction;
+
+		if (opCode == GetEnumAsValue(OpCode::PREFIX))
+		{
+			const uint8_t prefixedOpCode = FetchPcAddress();
+			instruction = prefixedInstructions[prefixedOpCode];
+			if (instruction == nullptr)
+				AbortOnMissingInstruction((opCode << 8) | prefixedOpCode);
+		}
+		else
+		{
+			instruction = instructions[opCode];
+			if (instruction == nullptr)
+				AbortOnMissingInstruction(opCode);
+		}
+		return instruction(this);
+	}
+}
+
+#if defined(PLAY_MAN_THREADED_DISPATCH)
+
+#if !defined(__GNUC__)
+	#error "The threaded dispatch core requires the labels as values extension (GCC or Clang)"
+#endif
+
+/**
+ * @brief Expands x for every opcode in the range 0x00-0xFF.
+ */
+#define OPCODE_ROW(x, row) \
+	x(row##0) x(row##1) x(row##2) x(row##3) x(row##4) x(row##5) x(row##6) x(row##7) \
+	x(row##8) x(row##9) x(row##A) x(row##B) x(row##C) x(row##D) x(row##E) x(row##F)
+
+#define FOR_EACH_OPCODE(x) \
+	OPCODE_ROW(x, 0x0) OPCODE_ROW(x, 0x1) OPCODE_ROW(x, 0x2) OPCODE_ROW(x, 0x3) \
+	OPCODE_ROW(x, 0x4) OPCODE_ROW(x, 0x5) OPCODE_ROW(x, 0x6) OPCODE_ROW(x, 0x7) \
+	OPCODE_ROW(x, 0x8) OPCODE_ROW(x, 0x9) OPCODE_ROW(x, 0xA) OPCODE_ROW(x, 0xB) \
+	OPCODE_ROW(x, 0xC) OPCODE_ROW(x, 0xD) OPCODE_ROW(x, 0xE) OPCODE_ROW(x, 0xF)
+
+// Labels as values and computed gotos are GNU extensions.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+
+namespace GameBoy
+{
+	template<bool CheckStopCondition, typename Timing>
+	size_t Cpu::Dispatch(size_t cycleBudget, StopCondition stopCondition)
+	{
+		// The tables are evaluated in this translation unit, so every label below calls its handler
+		// directly (and can inline it) instead of loading a function pointer and calling through it.
+		static constexpr InstructionTable table = MakeInstructionTable();
+		static constexpr PrefixedInstructionTable prefixedTable = MakePrefixedInstructionTable();
+
+		#define HANDLER_ADDRESS(opCode) &&Handler_##opCode,
+		#define PREFIXED_HANDLER_ADDRESS(opCode) &&PrefixedHandler_##opCode,
+		static void* const handlers[numberOfInstructions] = { FOR_EACH_OPCODE(HANDLER_ADDRESS) };
+		static void* const prefixedHandlers[numberOfPrefixedInstructions] = { FOR_EACH_OPCODE(PREFIXED_HANDLER_ADDRESS) };
+		#undef PREFIXED_HANDLER_ADDRESS
+		#undef HANDLER_ADDRESS
+
+		const size_t start = cycles;
+
+		// Every handler ends in its own indirect jump to the next handler, instead of all instructions
+		// sharing the single (badly predicted) branch at the top of a dispatch loop.
+		#define DISPATCH_NEXT()                                                                         \
+			if (cycles - start >= cycleBudget ||                                                        \
+				(CheckStopCondition && stopCondition.shouldStop(stopCondition.context)))                \
+			{                                                                                           \
+				core.MaterializeFlags();                                                                \
+				return cycles - start;                                                                  \
+			}                                                                                           \
+			goto *handlers[FetchPcAddress()];
+
+		// The prefix byte jumps straight on to the label of the prefixed opcode that follows it.
+		#define HANDLER(opCode)                                                                         \
+			Handler_##opCode:                                                                           \
+			{                                                                                           \
+				constexpr InstructionPrototype instruction = table[opCode];                             \
+				if constexpr (opCode == GetEnumAsValue(OpCode::PREFIX))                                 \
+					goto *prefixedHandlers[FetchPcAddress()];                                           \
+				else if constexpr (instruction == nullptr)                                              \
+					AbortOnMissingInstruction(opCode);                                                  \
+				else                                                                                    \
+					Timing::Retire(cycles, memoryBus, instruction(this));                               \
+			}                                                                                           \
+			DISPATCH_NEXT();
+
+		#define PREFIXED_HANDLER(opCode)                                                                \
+			PrefixedHandler_##opCode:                                                                   \
+			{                                                                                           \
+				constexpr InstructionPrototype instruction = prefixedTable[opCode];                     \
+				if constexpr (instruction == nullptr)                                                   \
+					AbortOnMissingInstruction((GetEnumAsValue(OpCode::PREFIX) << 8) | opCode);          \
+				else                                                                                    \
+					Timing::Retire(cycles, memoryBus, instruction(this));                               \
+			}                                                                                           \
+			DISPATCH_NEXT();
+
+		DISPATCH_NEXT();
+		FOR_EACH_OPCODE(HANDLER)
+		FOR_EACH_OPCODE(PREFIXED_HANDLER)
+
+		#undef PREFIXED_HANDLER
+		#undef HANDLER
+		#undef DISPATCH_NEXT
+	}
+}
+
+#pragma GCC diagnostic pop
+
+#undef FOR_EACH_OPCODE
+#undef OPCODE_ROW
+
+#else /* PLAY_MAN_THREADED_DISPATCH */
+
+namespace GameBoy
+{
+	template<bool CheckStopCondition, typename Timing>
+	size_t Cpu::Dispatch(size_t cycleBudget, StopCondition stopCondition)
+	{
+		const size_t start = cycles;
+
+		while (cycles - start < cycleBudget)
+		{
+			if constexpr (CheckStopCondition)
+			{
+				if (stopCondition.shouldStop(stopCondition.context))
+					break;
+			}
+
+			Timing::Retire(cycles, memoryBus, FetchAndExecute());
+		}
+
+		core.MaterializeFlags();
+		return cycles - start;
+	}
+}
+
+#endif /* PLAY_MAN_THREADED_DISPATCH */
+
+/**
+ * @brief Returns the amount of immediate data bytes following a (non prefixed) opcode.
+ */
+static constexpr uint8_t ImmediateDataLength(GameBoy::OpCode opCode)
+{
+	using GameBoy::OpCode;
+
+	switch (opCode)
+	{
+		case OpCode::LD_BC_n16:   case OpCode::LD_DE_n16:   case OpCode::LD_HL_n16:   case OpCode::LD_SP_n16:
+		case OpCode::LD_a16_NI_SP:case OpCode::LD_a16_NI_A: case OpCode::LD_A_a16_NI:
+		case OpCode::JP_a16:      case OpCode::JP_NZ_a16:   case OpCode::JP_Z_a16:    case OpCode::JP_NC_a16:   case OpCode::JP_C_a16:
+		case OpCode::CALL_a16:    case OpCode::CALL_NZ_a16: case OpCode::CALL_Z_a16:  case OpCode::CALL_NC_a16: case OpCode::CALL_C_a16:
+			return 2;
+
+		case OpCode::LD_B_n8:     case OpCode::LD_C_n8:     case OpCode::LD_D_n8:     case OpCode::LD_E_n8:
+		case OpCode::LD_H_n8:     case OpCode::LD_L_n8:     case OpCode::LD_HL_NI_n8: case OpCode::LD_A_n8:
+		case OpCode::ADD_A_n8:    case OpCode::ADC_A_n8:    case OpCode::SUB_A_n8:    case OpCode::SBC_A_n8:
+		case OpCode::AND_A_n8:    case OpCode::XOR_A_n8:    case OpCode::OR_A_n8:     case OpCode::CP_A_n8:
+		case OpCode::JR_e8:       case OpCode::JR_NZ_e8:    case OpCode::JR_Z_e8:     case OpCode::JR_NC_e8:    case OpCode::JR_C_e8:
+		case OpCode::LDH_a8_NI_A: case OpCode::LDH_A_a8_NI: case OpCode::ADD_SP_e8:   case OpCode::LD_HL_SP_INC_e8:
+		case OpCode::STOP_n8:
+			return 1;
+
+		default:
+			return 0;
+	}
+}
+
+/**
+ * @brief Whether the instruction (possibly) continues somewhere else than the next instruction,
+ *        which ends a basic block.
+ */
+static constexpr bool EndsBasicBlock(GameBoy::OpCode opCode)
+{
+	using GameBoy::OpCode;
+
+	switch (opCode)
+	{
+		case OpCode::JR_e8:    case OpCode::JR_NZ_e8:    case OpCode::JR_Z_e8:    case OpCode::JR_NC_e8:    case OpCode::JR_C_e8:
+		case OpCode::JP_a16:   case OpCode::JP_NZ_a16:   case OpCode::JP_Z_a16:   case OpCode::JP_NC_a16:   case OpCode::JP_C_a16:
+		case OpCode::JP_HL:
+		case OpCode::CALL_a16: case OpCode::CALL_NZ_a16: case OpCode::CALL_Z_a16: case OpCode::CALL_NC_a16: case OpCode::CALL_C_a16:
+		case OpCode::RET:      case OpCode::RET_NZ:      case OpCode::RET_Z:      case OpCode::RET_NC:      case OpCode::RET_C:
+		case OpCode::RETI:
+		case OpCode::RST_00:   case OpCode::RST_08:      case OpCode::RST_10:     case OpCode::RST_18:
+		case OpCode::RST_20:   case OpCode::RST_28:      case OpCode::RST_30:     case OpCode::RST_38:
+		case OpCode::HALT:     case OpCode::STOP_n8:     case OpCode::DI:         case OpCode::EI:
+		case OpCode::ILLEGAL_D3: case OpCode::ILLEGAL_DB: case OpCode::ILLEGAL_DD: case OpCode::ILLEGAL_E3:
+		case OpCode::ILLEGAL_E4: case OpCode::ILLEGAL_EB: case OpCode::ILLEGAL_EC: case OpCode::ILLEGAL_ED:
+		case OpCode::ILLEGAL_F4: case OpCode::ILLEGAL_FC: case OpCode::ILLEGAL_FD:
+			return true;
+
+		default:
+			return false;
+	}
+}
+
+/**
+ * @brief Whether the block polls the interrupt flag register in a loop: LDH A, (IF), followed by only
+ *        immediate ALU operations or BIT on A, ending in a conditional jump. Every iteration computes the
+ *        same registers from the same value, so until an event requests an interrupt repeating it does
+ *        not change anything but the cycle count.
+ * 
+ * @note Whether the jump goes back to the start of the block is checked when the block is executed.
+ */
+static bool IsIdleLoop(const uint8_t* code, uint32_t length)
+{
+	using GameBoy::OpCode;
+
+	if (length < 2 || code[0] != GetEnumAsValue(OpCode::LDH_A_a8_NI) || (0xFF00 | code[1]) != interruptFlagAddress)
+		return false;
+
+	for (uint32_t position = 2; position < length;)
+	{
+		const auto opCode = static_cast<OpCode>(code[position]);
+
+		switch (opCode)
+		{
+			case OpCode::AND_A_n8: case OpCode::OR_A_n8: case OpCode::XOR_A_n8: case OpCode::CP_A_n8:
+				position += 2;
+				break;
+
+			case OpCode::PREFIX:
+				if ((code[position + 1] & 0b1100'0111) != 0b0100'0111) // BIT b, A
+					return false;
+				position += 2;
+				break;
+
+			case OpCode::JR_NZ_e8:  case OpCode::JR_Z_e8:  case OpCode::JR_NC_e8:  case OpCode::JR_C_e8:
+			case OpCode::JP_NZ_a16: case OpCode::JP_Z_a16: case OpCode::JP_NC_a16: case OpCode::JP_C_a16:
+				return position + 1 + ImmediateDataLength(opCode) == length;
+
+			default:
+				return false;
+		}
+	}
+	return false;
+}
+
+namespace GameBoy
+{
+	DecodedBlock* Cpu::FindOrDecodeBlock()
+	{
+		if (memoryBus.WritableCodeGeneration() != blockCacheGeneration)
+		{
+			// Writable memory got remapped or decoded code inside RAM got written.
+			blockCache.FlushWritable();
+			blockCacheGeneration = memoryBus.WritableCodeGeneration();
+		}
+
+		const uint16_t address = core.PC.Value();
+		const uint8_t pageIndex = address >> memoryPageShift;
+		const uint8_t offset = address & memoryPageMask;
+		const uint8_t* page = memoryBus.GetReadPage(pageIndex);
+
+		if (page == nullptr)
+			return nullptr;
+		if (DecodedBlock* block = blockCache.Find(page, offset))
+			return block;
+		if (!memoryBus.ProtectCodePage(pageIndex))
+			return nullptr;
+
+		// Decodes until the first control flow instruction, blocks never leave their page.
+		uint32_t position = offset;
+
+		decodeBuffer.clear();
+		while (position < memoryPageSize)
+		{
+			const auto opCode = static_cast<OpCode>(page[position]);
+			const bool prefixed = (opCode == OpCode::PREFIX);
+			const uint32_t length = prefixed ? 2 : 1 + ImmediateDataLength(opCode);
+
+			if (position + length > memoryPageSize)
+				break;
+
+			const InstructionPrototype instruction = prefixed
+				? prefixedInstructions[static_cast<PrefixedOpCode>(page[position + 1])]
+				: instructions[opCode];
+
+			// Missing instructions are left to the regular path, which aborts on them.
+			if (instruction == nullptr)
+				break;
+
+			decodeBuffer.push_back(DecodedInstruction { instruction, static_cast<uint8_t>(prefixed ? 2 : 1), static_cast<uint8_t>(length) });
+			position += length;
+
+			if (EndsBasicBlock(opCode))
+				break;
+		}
+
+		if (decodeBuffer.empty())
+			return nullptr;
+
+		DecodedBlock* block = blockCache.Insert(page, offset, decodeBuffer, address > romBankAddressEnd);
+
+		block->idleLoop = IsIdleLoop(page + offset, position - offset);
+		return block;
+	}
+
+	template<bool CheckStopCondition>
+	size_t Cpu::DispatchBlocks(size_t cycleBudget, StopCondition stopCondition)
+	{
+		const size_t start = cycles;
+
+		const auto shouldStop = [&]() -> bool
+		{
+			if constexpr (CheckStopCondition)
+			{
+				if (stopCondition.shouldStop(stopCondition.context))
+					return true;
+			}
+			return cycles - start >= cycleBudget;
+		};
+
+		while (!shouldStop())
+		{
+			DecodedBlock* block = FindOrDecodeBlock();
+
+			if (block == nullptr)
+			{
+				cycles += FetchAndExecute();
+				continue;
+			}
+
+#if defined(PLAY_MAN_JIT)
+			// The translated code does not check the stop condition, so RunUntil keeps replaying.
+			// Idle loops are skipped by the replay loop instead.
+			if constexpr (!CheckStopCondition)
+			{
+				if (block->native == nullptr && !block->idleLoop && ++block->executions == jitHotBlockThreshold)
+				{
+					block->native = jit.Compile(*block, *this);
+
+					// Starts over with an empty code buffer, the blocks pointing into it are dropped as well.
+					if (block->native == nullptr && jit.Full())
+					{
+						ClearBlockCache();
+						continue;
+					}
+				}
+				if (block->native != nullptr)
+				{
+					block->native(this, cycleBudget - (cycles - start));
+					continue;
+				}
+			}
+#endif
+
+			const DecodedInstruction* instruction = block->instructions.data();
+			const uint16_t blockAddress = core.PC.Value();
+			const size_t blockStart = cycles;
+
+			// Once the code generation changes the rest of the block might be stale or mapped out.
+			const uint32_t generation = memoryBus.CodeGeneration();
+			do
+			{
+				core.PC += instruction->opCodeLength;
+				cycles += instruction->execute(this);
+				instruction++;
+			}
+			while (instruction->execute != nullptr && memoryBus.CodeGeneration() == generation && !shouldStop());
+
+			// An idle loop that jumped back to itself keeps doing so until the slice ends at the next event.
+			// Only whole iterations are skipped, the last one runs normally so the budget ends at the same
+			// instruction as without skipping. RunUntil's predicate might depend on the skipped iterations.
+			if constexpr (!CheckStopCondition)
+			{
+				if (block->idleLoop && instruction->execute == nullptr && core.PC.Value() == blockAddress
+					&& memoryBus.CodeGeneration() == generation && cycles - start < cycleBudget)
+				{
+					const size_t iteration = cycles - blockStart;
+					const size_t remaining = cycleBudget - (cycles - start);
+
+					cycles += (remaining - 1) / iteration * iteration;
+				}
+			}
+		}
+
+		core.MaterializeFlags();
+		return cycles - start;
+	}
+
+	template<bool CheckStopCondition, typename Timing>
+	size_t Cpu::Run(size_t cycleBudget, StopCondition stopCondition)
+	{
+		size_t elapsed = 0;
+
+		// Only accesses made by the executed instructions are timed, not those from outside of Run.
+		if constexpr (Timing::advancesPerAccess)
+			memoryBus.SetAccessClock(&cycles);
+
+		scheduler.RunDueEvents(cycles);
+		while (elapsed < cycleBudget)
+		{
+			// Nothing is due before the next deadline, so the dispatch loops do not have to look at the scheduler.
+			const size_t slice = std::min(cycleBudget - elapsed, scheduler.NextDeadline() - cycles);
+			size_t executed;
+
+			sliceEnd = slice > std::numeric_limits<size_t>::max() - cycles ? std::numeric_limits<size_t>::max() : cycles + slice;
+			if (halted && core.InterruptPending())
+				halted = false;
+
+			if (halted)
+			{
+				if (CheckStopCondition && stopCondition.shouldStop(stopCondition.context))
+					break;
+
+				// Only an event can wake the cpu up, skip the whole slice at once.
+				cycles += slice;
+				executed = slice;
+			}
+			else if constexpr (!Timing::advancesPerAccess)
+			{
+				executed = blockCacheEnabled
+					? DispatchBlocks<CheckStopCondition>(slice, stopCondition)
+					: Dispatch<CheckStopCondition, Timing>(slice, stopCondition);
+			}
+			else
+			{
+				executed = Dispatch<CheckStopCondition, Timing>(slice, stopCondition);
+			}
+
+			elapsed += executed;
+			scheduler.RunDueEvents(cycles);
+
+			// The slice can only end early because of the stop condition.
+			if (CheckStopCondition && executed < slice)
+				break;
+		}
+
+		// Instructions executed outside of Run (e.g. ExecuteInstruction) are not inside a slice.
+		sliceEnd = 0;
+
+		if constexpr (Timing::advancesPerAccess)
+			memoryBus.SetAccessClock(nullptr);
+		return elapsed;
+	}
+
+	size_t Cpu::RunFor(size_t cycleBudget)
+	{
+		if (timingAccuracy == TimingAccuracy::Accurate)
+			return Run<false, AccurateTiming>(cycleBudget, StopCondition {});
+		return Run<false, FastTiming>(cycleBudget, StopCondition {});
+	}
+
+	void Cpu::SetBlockCacheEnabled(bool enabled)
+	{
+		blockCacheEnabled = enabled;
+		ClearBlockCache();
+	}
+
+	void Cpu::SetTimingAccuracy(TimingAccuracy accuracy)
+	{
+		timingAccuracy = accuracy;
+
+		// Only the memory bus' slow path times the accesses.
+		memoryBus.SetPageTablesEnabled(accuracy != TimingAccuracy::Accurate);
+		ClearBlockCache();
+	}
+
+	void Cpu::ClearBlockCache()
+	{
+		blockCache.Clear();
+#if defined(PLAY_MAN_JIT)
+		jit.Clear();
+#endif
+	}
+
+	// Used by RunUntil, which is defined inside the header.
+	template size_t Cpu::Run<true, FastTiming>(size_t cycleBudget, StopCondition stopCondition);
+	template size_t Cpu::Run<true, AccurateTiming>(size_t cycleBudget, StopCondition stopCondition);
+}
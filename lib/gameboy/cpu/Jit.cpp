@@ -0,0 +1,738 @@
+// ****************************************************************************** //
+//   _______   __                              __       __                        //
+//  /       \ /  |                            /  \     /  |                       //
+//  $$$$$$$  |$$ |  ______   __    __         $$  \   /$$ |  ______   _______     //
+//  $$ |__$$ |$$ | /      \ /  |  /  | ______ $$$  \ /$$$ | /      \ /       \    //
+//  $$    $$/ $$ | $$$$$$  |$$ |  $$ |/      |$$$$  /$$$$ | $$$$$$  |$$$$$$$  |   //
+//  $$$$$$$/  $$ | /    $$ |$$ |  $$ |$$$$$$/ $$ $$ $$/$$ | /    $$ |$$ |  $$ |   //
+//  $$ |      $$ |/$$$$$$$ |$$ \__$$ |        $$ |$$$/ $$ |/$$$$$$$ |$$ |  $$ |   //
+//  $$ |      $$ |$$    $$ |$$    $$ |        $$ | $/  $$ |$$    $$ |$$ |  $$ |   //
+//  $$/       $$/  $$$$$$$/  $$$$$$$ |        $$/      $$/  $$$$$$$/ $$/   $$/    //
+//                          /  \__$$ |                                            //
+//                          $$    $$/                                             //
+//                           $$$$$$/                                              //
+//                                                                                //
+//                            By: K1ngmar and rvan-mee                            //
+// ****************************************************************************** //
+
+#if defined(PLAY_MAN_JIT)
+
+#include <play-man/gameboy/cpu/Jit.hpp>
+#include <play-man/gameboy/cpu/Cpu.hpp>
+#include <play-man/logger/Logger.hpp>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+// The translated code works on the registers in place, the low byte of a register comes first.
+static_assert(sizeof(GameBoy::Register) == sizeof(uint16_t) && std::is_standard_layout_v<GameBoy::Register>);
+static_assert(std::is_standard_layout_v<GameBoy::LazyFlags> && sizeof(GameBoy::LazyFlagOperation) == sizeof(uint8_t));
+
+namespace
+{
+	using GameBoy::LazyFlagOperation;
+	using GameBoy::OpCode;
+
+	/**
+	 * @brief Where the translated code finds the state of the cpu, as displacements from the Cpu pointer in rbx.
+	 */
+	struct CpuLayout
+	{
+		std::array<int32_t, 8> registers; /*!< B, C, D, E, H, L, -, A: in the order of the register fields of the opcodes. */
+		std::array<int32_t, 4> registerPairs; /*!< BC, DE, HL, SP. */
+		int32_t programCounter;
+		int32_t cycles;
+		int32_t core;
+		int32_t flagOperation;
+		int32_t flagBase;
+		int32_t flagOperand;
+		int32_t flagResult;
+		int32_t flagCarryIn;
+		const uint32_t* codeGeneration;
+	};
+
+	/**
+	 * @brief The register field value that selects (HL) instead of a register.
+	 */
+	constexpr uint8_t indirectRegister = 6;
+
+	/**
+	 * @brief Condition codes of the rel32 jumps (the second opcode byte after 0x0F).
+	 */
+	constexpr uint8_t jumpBelow = 0x82;
+	constexpr uint8_t jumpAboveOrEqual = 0x83;
+	constexpr uint8_t jumpEqual = 0x84;
+	constexpr uint8_t jumpNotEqual = 0x85;
+
+	/**
+	 * @brief Called by the translated code when it needs a flag that was computed outside of the block.
+	 */
+	uint8_t ComputeFlags(const GameBoy::CpuCore* core)
+	{
+		return core->ComputeFlags();
+	}
+
+	/**
+	 * @brief Appends x86-64 instructions to a buffer, only the handful of encodings the translator uses.
+	 */
+	class Emitter
+	{
+		std::vector<uint8_t> bytes;
+
+	public:
+
+		void Bytes(std::initializer_list<uint8_t> values)
+		{
+			bytes.insert(bytes.end(), values);
+		}
+
+		template<typename T>
+		void Immediate(T value)
+		{
+			for (size_t i = 0; i < sizeof(T); i++)
+				bytes.push_back(static_cast<uint8_t>(static_cast<uint64_t>(value) >> (i * 8)));
+		}
+
+		/**
+		 * @brief Emits an instruction addressing [rbx + displacement], the last opcode byte is its ModRM byte.
+		 */
+		void Memory(std::initializer_list<uint8_t> opCode, int32_t displacement)
+		{
+			Bytes(opCode);
+			Immediate(displacement);
+		}
+
+		/**
+		 * @brief Emits a jump with a rel32 operand that still has to be bound, returns the position of that operand.
+		 */
+		size_t Jump(std::initializer_list<uint8_t> opCode)
+		{
+			Bytes(opCode);
+			Immediate<int32_t>(0);
+			return bytes.size() - sizeof(int32_t);
+		}
+
+		/**
+		 * @brief Points the rel32 operand of a jump at the target position.
+		 */
+		void Bind(size_t jump, size_t target)
+		{
+			const int32_t displacement = static_cast<int32_t>(target) - static_cast<int32_t>(jump + sizeof(int32_t));
+
+			std::memcpy(&bytes[jump], &displacement, sizeof(displacement));
+		}
+
+		size_t Position() const
+		{
+			return bytes.size();
+		}
+
+		const std::vector<uint8_t>& Code() const
+		{
+			return bytes;
+		}
+	};
+
+	/**
+	 * @brief Translates a single block.
+	 * 
+	 * The block is called as a NativeBlock (rdi: cpu, rsi: cycle budget) and keeps
+	 * rbx: cpu, rbp: program counter on entry, r12: cycle budget, r13: elapsed cycles,
+	 * r14: &codeGeneration, r15d: code generation on entry.
+	 * 
+	 * The program counter and the cycles of the inline instructions are only added to the cpu before
+	 * a handler gets called and when the block is left, every exit adds what is still pending.
+	 */
+	class Translator
+	{
+		/**
+		 * @brief A jump leaving the block, to a stub that adds the pending program counter and cycles first.
+		 */
+		struct Exit
+		{
+			size_t jump;
+			uint16_t programCounter;
+			uint32_t cycles;
+		};
+
+		Emitter& emitter;
+		const CpuLayout& layout;
+
+		size_t loopStart = 0; /*!< Where the block starts over when it jumps back to itself. */
+		uint16_t pendingProgramCounter = 0;
+		uint32_t pendingCycles = 0;
+		std::vector<Exit> exits;
+
+		/**
+		 * @brief The operation the lazy flags were last set by inside of the block, std::nullopt when they
+		 *        come from a handler or from before the block.
+		 */
+		std::optional<LazyFlagOperation> knownFlags;
+
+	public:
+
+		Translator(Emitter& emitter, const CpuLayout& layout)
+			: emitter(emitter), layout(layout) {}
+
+		void Prologue()
+		{
+			// Six pushes and the return address, the extra 8 bytes keep the stack 16 byte aligned for the calls.
+			emitter.Bytes({0x53, 0x55, 0x41, 0x54, 0x41, 0x55, 0x41, 0x56, 0x41, 0x57}); // push rbx, rbp, r12, r13, r14, r15
+			emitter.Bytes({0x48, 0x83, 0xEC, 0x08}); // sub rsp, 8
+			emitter.Bytes({0x48, 0x89, 0xFB}); // mov rbx, rdi
+			emitter.Bytes({0x49, 0x89, 0xF4}); // mov r12, rsi
+			emitter.Bytes({0x45, 0x31, 0xED}); // xor r13d, r13d
+			emitter.Bytes({0x49, 0xBE}); // mov r14, codeGeneration
+			emitter.Immediate(reinterpret_cast<uint64_t>(layout.codeGeneration));
+			emitter.Bytes({0x45, 0x8B, 0x3E}); // mov r15d, [r14]
+			emitter.Memory({0x0F, 0xB7, 0xAB}, layout.programCounter); // movzx ebp, word [PC]
+			loopStart = emitter.Position();
+		}
+
+		/**
+		 * @brief Emits the epilogue and the exit stubs.
+		 */
+		void Epilogue()
+		{
+			const size_t epilogue = emitter.Position();
+
+			emitter.Bytes({0x48, 0x83, 0xC4, 0x08}); // add rsp, 8
+			emitter.Bytes({0x41, 0x5F, 0x41, 0x5E, 0x41, 0x5D, 0x41, 0x5C, 0x5D, 0x5B}); // pop r15, r14, r13, r12, rbp, rbx
+			emitter.Bytes({0xC3}); // ret
+
+			for (const Exit& exit : exits)
+			{
+				emitter.Bind(exit.jump, emitter.Position());
+				AddProgramCounter(exit.programCounter);
+				if (exit.cycles != 0)
+				{
+					emitter.Memory({0x48, 0x81, 0x83}, layout.cycles); // add qword [cycles], imm32
+					emitter.Immediate(exit.cycles);
+				}
+				emitter.Bind(emitter.Jump({0xE9}), epilogue); // jmp epilogue
+			}
+		}
+
+		/**
+		 * @brief Translates an instruction.
+		 * 
+		 * @param instruction The decoded instruction.
+		 * @param code The bytes of the instruction.
+		 * @param blockOffset The distance of the instruction to the start of the block.
+		 * @param last Whether it is the last instruction of the block.
+		 */
+		void Translate(const GameBoy::DecodedInstruction& instruction, const uint8_t* code, uint16_t blockOffset, bool last)
+		{
+			const uint8_t opCode = code[0];
+			const uint8_t high = (opCode >> 3) & 7; // Destination register or ALU operation.
+			const uint8_t low = opCode & 7; // Source register.
+			const bool prefixed = (opCode == GetEnumAsValue(OpCode::PREFIX));
+
+			if (prefixed)
+				return CallHandler(instruction, last);
+
+			if (opCode == GetEnumAsValue(OpCode::NOP))
+				Retire(instruction.length, 1);
+			else if ((opCode & 0xC0) == 0x40 && opCode != GetEnumAsValue(OpCode::HALT) && high != indirectRegister && low != indirectRegister)
+				Load(high, low);
+			else if ((opCode & 0xC7) == 0x06 && high != indirectRegister)
+				LoadImmediate(high, code[1]);
+			else if ((opCode & 0xCF) == 0x01)
+				LoadPairImmediate(opCode >> 4, code[1] | (code[2] << 8));
+			else if ((opCode & 0xC7) == 0x03)
+				StepPair(opCode >> 4, (opCode & 0x08) != 0);
+			else if ((opCode & 0xC6) == 0x04 && high != indirectRegister)
+				IncrementDecrement(high, (opCode & 1) != 0);
+			else if ((opCode & 0xC0) == 0x80 && low != indirectRegister)
+				Arithmetic(high, low, std::nullopt);
+			else if ((opCode & 0xC7) == 0xC6)
+				Arithmetic(high, 0, code[1]);
+			else if (opCode == GetEnumAsValue(OpCode::JR_e8) || (opCode & 0xE7) == 0x20)
+				return JumpRelative(opCode, instruction.length, blockOffset, code[1]);
+			else if (opCode == GetEnumAsValue(OpCode::JP_a16) || (opCode & 0xE7) == 0xC2)
+				return JumpAbsolute(opCode, instruction.length, code[1] | (code[2] << 8));
+			else
+				return CallHandler(instruction, last);
+
+			if (last)
+				LeaveBlock();
+			else
+				CheckBudget();
+		}
+
+	private:
+
+		void Retire(uint16_t length, uint32_t cycles)
+		{
+			pendingProgramCounter += length;
+			pendingCycles += cycles;
+		}
+
+		void AddProgramCounter(uint16_t delta)
+		{
+			if (delta != 0)
+			{
+				emitter.Memory({0x66, 0x81, 0x83}, layout.programCounter); // add word [PC], imm16
+				emitter.Immediate(delta);
+			}
+		}
+
+		/**
+		 * @brief Adds the pending program counter and cycles to the cpu.
+		 */
+		void Flush()
+		{
+			AddProgramCounter(pendingProgramCounter);
+			if (pendingCycles != 0)
+			{
+				emitter.Memory({0x48, 0x81, 0x83}, layout.cycles); // add qword [cycles], imm32
+				emitter.Immediate(pendingCycles);
+				emitter.Bytes({0x49, 0x81, 0xC5}); // add r13, imm32
+				emitter.Immediate(pendingCycles);
+			}
+			pendingProgramCounter = 0;
+			pendingCycles = 0;
+		}
+
+		/**
+		 * @brief Leaves the block when the condition holds, the exit adds what is pending at this point.
+		 */
+		void ExitIf(uint8_t condition)
+		{
+			exits.push_back(Exit { emitter.Jump({0x0F, condition}), pendingProgramCounter, pendingCycles });
+		}
+
+		void LeaveBlock()
+		{
+			exits.push_back(Exit { emitter.Jump({0xE9}), pendingProgramCounter, pendingCycles });
+		}
+
+		/**
+		 * @brief Leaves the block once the budget is used up, like the replay loop does after every instruction.
+		 */
+		void CheckBudget()
+		{
+			if (pendingCycles == 0)
+			{
+				emitter.Bytes({0x4D, 0x39, 0xE5}); // cmp r13, r12
+			}
+			else
+			{
+				emitter.Bytes({0x49, 0x8D, 0x85}); // lea rax, [r13 + pendingCycles]
+				emitter.Immediate(pendingCycles);
+				emitter.Bytes({0x4C, 0x39, 0xE0}); // cmp rax, r12
+			}
+			ExitIf(jumpAboveOrEqual);
+		}
+
+		/**
+		 * @brief Starts the block over while budget is left, after the program counter got back to its start.
+		 */
+		void LoopOrLeave()
+		{
+			Flush();
+			emitter.Bytes({0x4D, 0x39, 0xE5}); // cmp r13, r12
+			emitter.Bind(emitter.Jump({0x0F, jumpBelow}), loopStart); // jb loopStart
+			LeaveBlock();
+		}
+
+		void CallHandler(const GameBoy::DecodedInstruction& instruction, bool last)
+		{
+			// The handler fetches its own immediate data.
+			pendingProgramCounter += instruction.opCodeLength;
+			Flush();
+			emitter.Bytes({0x48, 0x89, 0xDF}); // mov rdi, rbx
+			emitter.Bytes({0x48, 0xB8}); // mov rax, handler
+			emitter.Immediate(reinterpret_cast<uint64_t>(instruction.execute));
+			emitter.Bytes({0xFF, 0xD0}); // call rax
+			emitter.Memory({0x48, 0x01, 0x83}, layout.cycles); // add qword [cycles], rax
+			emitter.Bytes({0x49, 0x01, 0xC5}); // add r13, rax
+			knownFlags = std::nullopt;
+
+			if (last)
+			{
+				LeaveBlock();
+				return;
+			}
+
+			// The handler might have remapped or overwritten the rest of the block.
+			emitter.Bytes({0x45, 0x3B, 0x3E}); // cmp r15d, [r14]
+			ExitIf(jumpNotEqual);
+			CheckBudget();
+		}
+
+		void Load(uint8_t destination, uint8_t source)
+		{
+			emitter.Memory({0x0F, 0xB6, 0x83}, layout.registers[source]); // movzx eax, byte [source]
+			emitter.Memory({0x88, 0x83}, layout.registers[destination]); // mov [destination], al
+			Retire(1, 1);
+		}
+
+		void LoadImmediate(uint8_t destination, uint8_t value)
+		{
+			emitter.Memory({0xC6, 0x83}, layout.registers[destination]); // mov byte [destination], imm8
+			emitter.Immediate(value);
+			Retire(2, 2);
+		}
+
+		void LoadPairImmediate(uint8_t pair, uint16_t value)
+		{
+			emitter.Memory({0x66, 0xC7, 0x83}, layout.registerPairs[pair & 3]); // mov word [pair], imm16
+			emitter.Immediate(value);
+			Retire(3, 3);
+		}
+
+		void StepPair(uint8_t pair, bool decrement)
+		{
+			emitter.Memory({0x66, 0xFF, static_cast<uint8_t>(decrement ? 0x8B : 0x83)}, layout.registerPairs[pair & 3]); // inc/dec word [pair]
+			Retire(1, 2);
+		}
+
+		/**
+		 * @brief Stores the operation and the operands (al: base, cl: operand, dl: result) of the lazy flags.
+		 */
+		void SetFlagsLazy(LazyFlagOperation operation)
+		{
+			emitter.Memory({0xC6, 0x83}, layout.flagOperation); // mov byte [operation], imm8
+			emitter.Immediate(static_cast<uint8_t>(operation));
+			emitter.Memory({0x88, 0x83}, layout.flagBase); // mov [base], al
+			emitter.Memory({0x88, 0x8B}, layout.flagOperand); // mov [operand], cl
+			emitter.Memory({0x88, 0x93}, layout.flagResult); // mov [result], dl
+			knownFlags = operation;
+		}
+
+		/**
+		 * @brief Loads the carry flag into eax (0 or 1), clobbers ecx.
+		 */
+		void LoadCarryFlag()
+		{
+			switch (knownFlags.value_or(LazyFlagOperation::None))
+			{
+				case LazyFlagOperation::Add:
+				case LazyFlagOperation::Sub:
+				{
+					const bool add = (*knownFlags == LazyFlagOperation::Add);
+
+					// The carry is the bit above the 8 bit result of base +/- operand +/- carryIn.
+					emitter.Memory({0x0F, 0xB6, 0x83}, layout.flagBase); // movzx eax, byte [base]
+					emitter.Memory({0x0F, 0xB6, 0x8B}, layout.flagOperand); // movzx ecx, byte [operand]
+					emitter.Bytes({static_cast<uint8_t>(add ? 0x01 : 0x29), 0xC8}); // add/sub eax, ecx
+					emitter.Memory({0x0F, 0xB6, 0x8B}, layout.flagCarryIn); // movzx ecx, byte [carryIn]
+					emitter.Bytes({static_cast<uint8_t>(add ? 0x01 : 0x29), 0xC8}); // add/sub eax, ecx
+					emitter.Bytes({0xC1, 0xE8, static_cast<uint8_t>(add ? 8 : 31)}); // shr eax, 8/31
+					break;
+				}
+				case LazyFlagOperation::Increment:
+				case LazyFlagOperation::Decrement:
+					emitter.Memory({0x0F, 0xB6, 0x83}, layout.flagCarryIn); // movzx eax, byte [carryIn]
+					break;
+				case LazyFlagOperation::And:
+				case LazyFlagOperation::Or:
+					emitter.Bytes({0x31, 0xC0}); // xor eax, eax
+					break;
+				case LazyFlagOperation::None:
+					CallComputeFlags();
+					emitter.Bytes({0xC1, 0xE8, 0x04}); // shr eax, 4
+					emitter.Bytes({0x83, 0xE0, 0x01}); // and eax, 1
+					break;
+			}
+		}
+
+		/**
+		 * @brief Loads the zero flag into eax (0 or 1).
+		 */
+		void LoadZeroFlag()
+		{
+			if (knownFlags.has_value())
+			{
+				// Every operation sets the zero flag from its 8 bit result.
+				emitter.Memory({0x80, 0xBB}, layout.flagResult); // cmp byte [result], 0
+				emitter.Immediate<uint8_t>(0);
+				emitter.Bytes({0x0F, 0x94, 0xC0}); // sete al
+				emitter.Bytes({0x0F, 0xB6, 0xC0}); // movzx eax, al
+			}
+			else
+			{
+				CallComputeFlags();
+				emitter.Bytes({0xC1, 0xE8, 0x07}); // shr eax, 7
+			}
+		}
+
+		/**
+		 * @brief Loads the upper nibble of the F register into eax, for flags set outside of the block.
+		 */
+		void CallComputeFlags()
+		{
+			emitter.Memory({0x48, 0x8D, 0xBB}, layout.core); // lea rdi, [core]
+			emitter.Bytes({0x48, 0xB8}); // mov rax, ComputeFlags
+			emitter.Immediate(reinterpret_cast<uint64_t>(&ComputeFlags));
+			emitter.Bytes({0xFF, 0xD0}); // call rax
+			emitter.Bytes({0x0F, 0xB6, 0xC0}); // movzx eax, al
+		}
+
+		void IncrementDecrement(uint8_t target, bool decrement)
+		{
+			// INC and DEC keep the carry flag.
+			LoadCarryFlag();
+			emitter.Memory({0x88, 0x83}, layout.flagCarryIn); // mov [carryIn], al
+			emitter.Memory({0x0F, 0xB6, 0x83}, layout.registers[target]); // movzx eax, byte [target]
+			emitter.Bytes({0xB9, 0x01, 0x00, 0x00, 0x00}); // mov ecx, 1
+			emitter.Bytes({0x89, 0xC2}); // mov edx, eax
+			emitter.Bytes({0xFE, static_cast<uint8_t>(decrement ? 0xCA : 0xC2)}); // inc/dec dl
+			emitter.Memory({0x88, 0x93}, layout.registers[target]); // mov [target], dl
+			SetFlagsLazy(decrement ? LazyFlagOperation::Decrement : LazyFlagOperation::Increment);
+			Retire(1, 1);
+		}
+
+		/**
+		 * @brief ADD, ADC, SUB, SBC, AND, XOR, OR or CP of A with a register or immediate value.
+		 */
+		void Arithmetic(uint8_t operation, uint8_t source, std::optional<uint8_t> immediate)
+		{
+			enum : uint8_t { Add, AddCarry, Sub, SubCarry, And, Xor, Or, Compare };
+
+			const bool withCarry = (operation == AddCarry || operation == SubCarry);
+
+			if (withCarry)
+				LoadCarryFlag();
+			else
+				emitter.Bytes({0x31, 0xC0}); // xor eax, eax
+			emitter.Memory({0x88, 0x83}, layout.flagCarryIn); // mov [carryIn], al
+			emitter.Bytes({0x89, 0xC2}); // mov edx, eax
+
+			if (immediate.has_value())
+			{
+				emitter.Bytes({0xB9}); // mov ecx, imm32
+				emitter.Immediate<uint32_t>(*immediate);
+			}
+			else
+			{
+				emitter.Memory({0x0F, 0xB6, 0x8B}, layout.registers[source]); // movzx ecx, byte [source]
+			}
+			emitter.Memory({0x0F, 0xB6, 0x83}, layout.registers[7]); // movzx eax, byte [A]
+
+			// dl = al op cl (op dl), al keeps the base for the lazy flags.
+			LazyFlagOperation flags;
+			switch (operation)
+			{
+				case Add:
+				case AddCarry:
+					emitter.Bytes({0x00, 0xCA}); // add dl, cl
+					emitter.Bytes({0x00, 0xC2}); // add dl, al
+					flags = LazyFlagOperation::Add;
+					break;
+				case Sub:
+				case SubCarry:
+				case Compare:
+					emitter.Bytes({0x00, 0xCA}); // add dl, cl
+					emitter.Bytes({0xF6, 0xDA}); // neg dl
+					emitter.Bytes({0x00, 0xC2}); // add dl, al
+					flags = LazyFlagOperation::Sub;
+					break;
+				case And:
+					emitter.Bytes({0x89, 0xC2}); // mov edx, eax
+					emitter.Bytes({0x20, 0xCA}); // and dl, cl
+					flags = LazyFlagOperation::And;
+					break;
+				case Xor:
+					emitter.Bytes({0x89, 0xC2}); // mov edx, eax
+					emitter.Bytes({0x30, 0xCA}); // xor dl, cl
+					flags = LazyFlagOperation::Or;
+					break;
+				default:
+					emitter.Bytes({0x89, 0xC2}); // mov edx, eax
+					emitter.Bytes({0x08, 0xCA}); // or dl, cl
+					flags = LazyFlagOperation::Or;
+					break;
+			}
+
+			if (operation != Compare)
+				emitter.Memory({0x88, 0x93}, layout.registers[7]); // mov [A], dl
+			SetFlagsLazy(flags);
+			Retire(immediate.has_value() ? 2 : 1, immediate.has_value() ? 2 : 1);
+		}
+
+		/**
+		 * @brief Loads the flag a conditional jump tests and returns the condition code of the jump
+		 *        that is taken when the jump is not.
+		 */
+		uint8_t Condition(uint8_t opCode)
+		{
+			const bool carry = (opCode & 0x10) != 0;
+			const bool expected = (opCode & 0x08) != 0;
+
+			if (carry)
+				LoadCarryFlag();
+			else
+				LoadZeroFlag();
+			emitter.Bytes({0x85, 0xC0}); // test eax, eax
+			return expected ? jumpEqual : jumpNotEqual;
+		}
+
+		void JumpRelative(uint8_t opCode, uint8_t length, uint16_t blockOffset, uint8_t immediate)
+		{
+			// Moves the same distance as Cpu::Jump_Relative_8bit_SignedImmediateData.
+			const uint16_t distance = immediate > 127 ? static_cast<uint16_t>(-immediate) : immediate;
+			const bool conditional = (opCode != GetEnumAsValue(OpCode::JR_e8));
+			std::optional<size_t> notTaken;
+
+			if (conditional)
+				notTaken = emitter.Jump({0x0F, Condition(opCode)});
+
+			const uint16_t pending = pendingProgramCounter;
+			const uint32_t cycles = pendingCycles;
+
+			Retire(length + distance, 3);
+			if (static_cast<uint16_t>(blockOffset + length + distance) == 0)
+				LoopOrLeave();
+			else
+				LeaveBlock();
+
+			if (notTaken.has_value())
+			{
+				emitter.Bind(*notTaken, emitter.Position());
+				pendingProgramCounter = pending;
+				pendingCycles = cycles;
+				Retire(length, 2);
+				LeaveBlock();
+			}
+		}
+
+		void JumpAbsolute(uint8_t opCode, uint8_t length, uint16_t target)
+		{
+			const bool conditional = (opCode != GetEnumAsValue(OpCode::JP_a16));
+			std::optional<size_t> notTaken;
+
+			if (conditional)
+				notTaken = emitter.Jump({0x0F, Condition(opCode)});
+
+			const uint16_t pending = pendingProgramCounter;
+			const uint32_t cycles = pendingCycles;
+
+			// The block might be mapped at more than one address, only the program counter on entry tells.
+			emitter.Memory({0x66, 0xC7, 0x83}, layout.programCounter); // mov word [PC], target
+			emitter.Immediate(target);
+			pendingProgramCounter = 0;
+			pendingCycles += 4;
+			Flush();
+			emitter.Bytes({0x66, 0x81, 0xFD}); // cmp bp, target
+			emitter.Immediate(target);
+			ExitIf(jumpNotEqual);
+			LoopOrLeave();
+
+			if (notTaken.has_value())
+			{
+				emitter.Bind(*notTaken, emitter.Position());
+				pendingProgramCounter = pending;
+				pendingCycles = cycles;
+				Retire(length, 3);
+				LeaveBlock();
+			}
+		}
+	};
+}
+
+namespace GameBoy
+{
+	Jit::~Jit()
+	{
+		if (code != nullptr)
+			munmap(code, codeBufferSize);
+	}
+
+	NativeBlock Jit::Compile(const DecodedBlock& block, Cpu& cpu)
+	{
+		const auto displacement = [&cpu](const void* field)
+		{
+			return static_cast<int32_t>(static_cast<const uint8_t*>(field) - reinterpret_cast<const uint8_t*>(&cpu));
+		};
+		const auto highByte = [&](const Register& pair) { return displacement(&pair) + 1; };
+		const auto lowByte = [&](const Register& pair) { return displacement(&pair); };
+
+		CpuCore& core = cpu.core;
+		const CpuLayout layout
+		{
+			.registers = { highByte(core.BC), lowByte(core.BC), highByte(core.DE), lowByte(core.DE),
+				highByte(core.HL), lowByte(core.HL), 0, highByte(core.AF) },
+			.registerPairs = { displacement(&core.BC), displacement(&core.DE), displacement(&core.HL), displacement(&core.SP) },
+			.programCounter = displacement(&core.PC),
+			.cycles = displacement(&cpu.cycles),
+			.core = displacement(&core),
+			.flagOperation = displacement(&core.lazyFlags.operation),
+			.flagBase = displacement(&core.lazyFlags.base),
+			.flagOperand = displacement(&core.lazyFlags.operand),
+			.flagResult = displacement(&core.lazyFlags.result),
+			.flagCarryIn = displacement(&core.lazyFlags.carryIn),
+			.codeGeneration = cpu.memoryBus.CodeGenerationAddress(),
+		};
+
+		// The block was just found at the program counter, so its bytes are still mapped there.
+		const uint16_t address = core.PC.Value();
+		const uint8_t* source = cpu.memoryBus.GetReadPage(address >> memoryPageShift) + (address & memoryPageMask);
+
+		Emitter emitter;
+		Translator translator(emitter, layout);
+		uint16_t blockOffset = 0;
+
+		translator.Prologue();
+		for (const DecodedInstruction* instruction = block.instructions.data(); instruction->execute != nullptr; instruction++)
+		{
+			translator.Translate(*instruction, source + blockOffset, blockOffset, instruction[1].execute == nullptr);
+			blockOffset += instruction->length;
+		}
+		translator.Epilogue();
+
+		if (code == nullptr)
+		{
+			void* mapped = mmap(nullptr, codeBufferSize, PROT_READ | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+			if (mapped == MAP_FAILED)
+				return nullptr;
+			code = static_cast<uint8_t*>(mapped);
+		}
+
+		const std::vector<uint8_t>& bytes = emitter.Code();
+
+		if (bytes.size() > codeBufferSize - used)
+		{
+			full = true;
+			return nullptr;
+		}
+
+		// Only the pages the block gets written to are made writable.
+		const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+		uint8_t* const entry = code + used;
+		uint8_t* const firstPage = code + used / pageSize * pageSize;
+		const size_t length = (entry + bytes.size()) - firstPage;
+
+		if (mprotect(firstPage, length, PROT_READ | PROT_WRITE) != 0)
+			return nullptr;
+
+		std::memcpy(entry, bytes.data(), bytes.size());
+		used = std::min(codeBufferSize, used + ((bytes.size() + 15) & ~static_cast<size_t>(15)));
+
+		if (mprotect(firstPage, length, PROT_READ | PROT_EXEC) != 0)
+		{
+			// Other translated blocks live in the same pages and can not run anymore either.
+			LOG_FATAL("Unable to make the translated code executable");
+			abort();
+		}
+		return reinterpret_cast<NativeBlock>(entry);
+	}
+
+	void Jit::Clear()
+	{
+		used = 0;
+		full = false;
+	}
+}
+
+#endif
@@ -17,11 +17,174 @@
 
 #include <play-man/gameboy/memory/MemoryBus.hpp>
 #include <play-man/gameboy/memory/MemoryBusDefines.hpp>
+#include <play-man/gameboy/cartridge/Cartridge.hpp>
 #include <play-man/logger/Logger.hpp>
 #include <assert.h>
 
 namespace GameBoy {
 
+MemoryBus::MemoryBus(std::shared_ptr<ACartridge> _cartridge, CpuCore& _core, Timer& _timer) : cartridge(_cartridge), mapper(cartridge->GetMapper()), core(_core), timer(_timer)
+{
+    MapWorkRam();
+    MapCartridge();
+}
+
+bool MemoryBus::MapPage(const uint8_t page, const uint8_t* read, uint8_t* write, DirtyPages::Marker dirtyMarker)
+{
+    if (!pageTablesEnabled)
+    {
+        read = nullptr;
+        write = nullptr;
+    }
+
+    // A protected page keeps its write pointer aside, see ProtectCodePage.
+    uint8_t* const mappedWrite = codePages[page] ? codeWritePages[page] : writePages[page];
+    if (readPages[page] == read && mappedWrite == write)
+        return false;
+
+    if (codePages[page])
+    {
+        codePages[page] = false;
+        codeWritePages[page] = nullptr;
+    }
+    readPages[page] = read;
+    writePages[page] = write;
+    if (write)
+        dirtyMarkers[page] = dirtyMarker;
+    return true;
+}
+
+bool MemoryBus::MapPages(const uint16_t start, const uint16_t end, const uint8_t* read, uint8_t* write,
+                         DirtyPages& dirtyPages, const size_t dirtyOffset)
+{
+    bool changed = false;
+
+    for (uint32_t address = start; address <= end; address += memoryPageSize)
+    {
+        const uint32_t offset = address - start;
+
+        changed |= MapPage(address >> memoryPageShift, read ? read + offset : nullptr, write ? write + offset : nullptr,
+                           write ? dirtyPages.GetMarker(dirtyOffset + offset) : DirtyPages::Marker {});
+    }
+    return changed;
+}
+
+void MemoryBus::MappingChanged(const bool writableChanged)
+{
+    fetchPageIndex = memoryPageCount;
+    codeGeneration++; // Stops the running block, the rest of it might have been mapped out.
+    if (writableChanged)
+    {
+        // Every block decoded from writable memory gets dropped, so none of the pages needs protecting anymore.
+        UnprotectCodePages();
+        writableCodeGeneration++;
+    }
+}
+
+void MemoryBus::MapWorkRam()
+{
+    const uint8_t switchableBank = core.GetCgbMode() ? workRamBank : 1;
+    uint8_t* switchableData = workRam[switchableBank].data();
+    bool changed = false;
+
+    changed |= MapPages(wRamAddressStart, wRamAddressEnd, workRam[0].data(), workRam[0].data(), workRamDirtyPages, 0);
+    changed |= MapPages(wRamBankAddressStart, wRamBankAddressEnd, switchableData, switchableData,
+                        workRamDirtyPages, switchableBank * sizeof(WorkRamBank));
+    if (changed)
+        MappingChanged(true);
+}
+
+void MemoryBus::MapCartridge()
+{
+    bool romChanged = false;
+    bool ramChanged = false;
+
+    // The cartridge decides per page what is mapped, ROM is never writable.
+    std::visit([&](auto* mapped)
+    {
+        for (uint32_t address = romAddressStart; address <= romBankAddressEnd; address += memoryPageSize)
+        {
+            romChanged |= MapPage(address >> memoryPageShift, mapped->GetReadPointer(address), nullptr, DirtyPages::Marker {});
+        }
+        for (uint32_t address = externalRamAddressStart; address <= externalRamAddressEnd; address += memoryPageSize)
+        {
+            uint8_t* write = mapped->GetWritePointer(address);
+
+            ramChanged |= MapPage(address >> memoryPageShift, mapped->GetReadPointer(address), write,
+                                  write ? mapped->GetRamDirtyMarker(write) : DirtyPages::Marker {});
+        }
+    }, mapper);
+    if (romChanged || ramChanged)
+        MappingChanged(ramChanged);
+}
+
+bool MemoryBus::ProtectCodePage(const uint8_t page)
+{
+    if (codePages[page] || page <= (romBankAddressEnd >> memoryPageShift))
+        return true; // ROM only changes when the page table does.
+    if (readPages[page] == nullptr || writePages[page] == nullptr)
+        return false;
+
+    codePages[page] = true;
+    codeWritePages[page] = writePages[page];
+    writePages[page] = nullptr;
+    return true;
+}
+
+void MemoryBus::UnprotectCodePages()
+{
+    for (uint32_t page = 0; page < memoryPageCount; page++)
+    {
+        if (codePages[page])
+        {
+            writePages[page] = codeWritePages[page];
+            codePages[page] = false;
+        }
+    }
+}
+
+void MemoryBus::SetPageTablesEnabled(const bool enabled)
+{
+    pageTablesEnabled = enabled;
+    MapWorkRam();
+    MapCartridge();
+}
+
+void MemoryBus::SaveState(SaveStateWriter& writer) const
+{
+    writer.BeginSection(MakeSaveStateId("WRAM"));
+    writer.Write(workRamBank);
+    writer.Write(workRam);
+    writer.EndSection();
+}
+
+void MemoryBus::LoadState(SaveStateReader& reader) noexcept(false)
+{
+    reader.BeginSection(MakeSaveStateId("WRAM"));
+    const uint8_t bank = reader.Read<uint8_t>();
+    reader.Read(workRam);
+    reader.EndSection();
+
+    workRamDirtyPages.MarkAll();
+    SetWorkRamBank(bank); // Also remaps the work RAM.
+    MappingChanged(true); // The memory kept its mapping, but code might have been decoded from its old contents.
+}
+
+void MemoryBus::ValidateState(SaveStateReader& reader) const noexcept(false)
+{
+    reader.BeginSection(MakeSaveStateId("WRAM"));
+    reader.Skip(sizeof(workRamBank) + sizeof(workRam)); // Every bank number is valid, it gets masked.
+    reader.EndSection();
+}
+
+void MemoryBus::SetWorkRamBank(const uint8_t value)
+{
+    workRamBank = value & wRamBankSelectMask;
+    if (workRamBank == 0)
+        workRamBank = 1;
+    MapWorkRam();
+}
+
 uint16_t MemoryBus::PopStack()
 {
     uint8_t lowerByte;
@@ -42,20 +205,27 @@ void MemoryBus::PushStack(uint16_t value)
     WriteByte(core.GetStackPointerDec(), lowerByte);
 }
 
-uint8_t MemoryBus::ReadByte(const Register reg)
+uint8_t MemoryBus::ReadCartridge(const uint16_t address)
+{
+    return std::visit([address](auto* mapped) { return mapped->ReadByte(address); }, mapper);
+}
+
+void MemoryBus::WriteCartridge(const uint16_t address, const uint8_t value)
 {
-    return (ReadByte(reg.Value()));
+    std::visit([address, value](auto* mapped) { mapped->WriteByte(address, value); }, mapper);
 }
 
-uint8_t MemoryBus::ReadByte(const uint16_t address)
+uint8_t MemoryBus::ReadByteSlow(const uint16_t address)
 {
+    TimeAccess();
+
     if (address >= romAddressStart && address <= romAddressEnd)
     {
-        return (cartridge->ReadByte(address));
+        return (ReadCartridge(address));
     }
     else if (address >= romBankAddressStart && address <= romBankAddressEnd)
     {
-        return (cartridge->ReadByte(address));
+        return (ReadCartridge(address));
     }
     else if (address >= vRamAddressStart && address <= vRamAddressEnd)
     {
@@ -63,7 +233,8 @@ uint8_t MemoryBus::ReadByte(const uint16_t address)
     }
     else if (address >= externalRamAddressStart && address <= externalRamAddressEnd)
     {
-        assert(false && "Fetching from this memory address is not supported yet!");
+        // Only reached when the cartridge could not map the page, e.g. disabled RAM or the RTC registers.
+        return (ReadCartridge(address));
     }
     else if (address >= wRamAddressStart && address <= wRamAddressEnd)
     {
@@ -73,8 +244,7 @@ uint8_t MemoryBus::ReadByte(const uint16_t address)
     {
         if (core.GetCgbMode() == true)
         {
-            // return (workRam[GetWorkRamBank()][address - wRamAddressStart]);
-            assert(false && "CGB mode not yet supported");
+            return (workRam[workRamBank][address - wRamBankAddressStart]);
         }
         else
         {
@@ -101,6 +271,16 @@ uint8_t MemoryBus::ReadByte(const uint16_t address)
     {
         assert(false && "Fetching from this memory address is not supported yet!");
     }
+    else if (address >= timerAddressStart && address <= timerAddressEnd)
+    {
+        return (timer.ReadByte(address));
+    }
+    else if (address == interruptFlagAddress)
+    {
+        // The timer might have overflowed since it was last synchronized.
+        timer.Synchronize();
+        return (core.GetInterruptFlags() | 0b1110'0000);
+    }
     else if (address >= hRamAddressStart && address <= hRamAddressEnd)
     {
         assert(false && "Fetching from this memory address is not supported yet!");
@@ -109,6 +289,11 @@ uint8_t MemoryBus::ReadByte(const uint16_t address)
     {
         return (core.GetInterruptRegister());
     }
+    else if (address == wRamBankSelectAddress && core.GetCgbMode() == true)
+    {
+        // The unused bits always read as 1.
+        return (workRamBank | 0b1111'1000);
+    }
     else
     {
         LOG_FATAL("Trying to read from an invalid address");
@@ -118,43 +303,48 @@ uint8_t MemoryBus::ReadByte(const uint16_t address)
     return (-1);
 }
 
-void MemoryBus::WriteByte(const Register reg, const uint8_t value)
+void MemoryBus::WriteByteSlow(const uint16_t address, const uint8_t value)
 {
-    WriteByte(reg.Value(), value);
-}
+    TimeAccess();
 
-void MemoryBus::WriteByte(const uint16_t address, const uint8_t value)
-{
-    if (address >= romAddressStart && address <= romAddressEnd)
+    if (codePages[address >> memoryPageShift])
     {
-        return (cartridge->WriteByte(address, value));
+        // Decoded code might get overwritten, which invalidates all blocks decoded from writable memory.
+        MappingChanged(true);
+        WriteByte(address, value);
+        return;
     }
-    else if (address >= romBankAddressStart && address <= romBankAddressEnd)
+
+    if (address >= romAddressStart && address <= romBankAddressEnd)
     {
-        return (cartridge->WriteByte(address, value));
+        // Writes to the ROM area change the cartridge's control registers,
+        // which can change what is mapped in the ROM and external RAM pages.
+        WriteCartridge(address, value);
+        MapCartridge();
     }
     else if (address >= vRamAddressStart && address <= vRamAddressEnd)
     {
+        // There is no VRAM yet, so VRAM writes are not dirty tracked either. Only the work RAM
+        // and the cartridge RAM pages are, consumers like a tile cache can not rely on it for VRAM.
         assert(false && "Writing to this memory address is not supported yet!");
     }
     else if (address >= externalRamAddressStart && address <= externalRamAddressEnd)
     {
-        assert(false && "Writing to this memory address is not supported yet!");
+        WriteCartridge(address, value);
     }
     else if (address >= wRamAddressStart && address <= wRamAddressEnd)
     {
-        workRam[0][address - wRamAddressStart] = value;
+        WriteWorkRam(0, address - wRamAddressStart, value);
     }
     else if (address >= wRamBankAddressStart && address <= wRamBankAddressEnd)
     {
         if (core.GetCgbMode() == true)
         {
-            // workRam[GetWorkRamBank()][wRamAddress] = value;
-            assert(false && "CGB mode not yet supported");
+            WriteWorkRam(workRamBank, address - wRamBankAddressStart, value);
         }
         else
         {
-            workRam[1][address - wRamBankAddressStart] = value;
+            WriteWorkRam(1, address - wRamBankAddressStart, value);
         }
     }
     else if (address >= echoRamAddressStart && address <= echoRamAddressEnd)
@@ -177,6 +367,16 @@ void MemoryBus::WriteByte(const uint16_t address, const uint8_t value)
     {
         assert(false && "Writing to this memory address is not supported yet!");
     }
+    else if (address >= timerAddressStart && address <= timerAddressEnd)
+    {
+        timer.WriteByte(address, value);
+    }
+    else if (address == interruptFlagAddress)
+    {
+        // Catch up first, otherwise an earlier overflow would set the bit again.
+        timer.Synchronize();
+        core.SetInterruptFlags(value & 0b0001'1111);
+    }
     else if (address >= hRamAddressStart && address <= hRamAddressEnd)
     {
         assert(false && "Writing to this memory address is not supported yet!");
@@ -185,20 +385,23 @@ void MemoryBus::WriteByte(const uint16_t address, const uint8_t value)
     {
         core.SetInterruptRegister(value);
     }
+    else if (address == wRamBankSelectAddress && core.GetCgbMode() == true)
+    {
+        SetWorkRamBank(value);
+    }
     else if (address >= wRamAddressStart && address <= wRamAddressEnd)
     {
-        workRam[0][address - wRamAddressStart] = value;
+        WriteWorkRam(0, address - wRamAddressStart, value);
     }
     else if (address >= wRamBankAddressStart && address <= wRamBankAddressEnd)
     {
         if (core.GetCgbMode() == true)
         {
-            // workRam[GetWorkRamBank()][wRamAddress] = value;
-            assert(false && "CGB mode not yet supported");
+            WriteWorkRam(workRamBank, address - wRamBankAddressStart, value);
         }
         else
         {
-            workRam[1][address - wRamBankAddressStart] = value;
+            WriteWorkRam(1, address - wRamBankAddressStart, value);
         }
     }
     else
@@ -0,0 +1,122 @@
+// ****************************************************************************** //
+//   _______   __                              __       __                        //
+//  /       \ /  |                            /  \     /  |                       //
+//  $$$$$$$  |$$ |  ______   __    __         $$  \   /$$ |  ______   _______     //
+//  $$ |__$$ |$$ | /      \ /  |  /  | ______ $$$  \ /$$$ | /      \ /       \    //
+//  $$    $$/ $$ | $$$$$$  |$$ |  $$ |/      |$$$$  /$$$$ | $$$$$$  |$$$$$$$  |   //
+//  $$$$$$$/  $$ | /    $$ |$$ |  $$ |$$$$$$/ $$ $$ $$/$$ | /    $$ |$$ |  $$ |   //
+//  $$ |      $$ |/$$$$$$$ |$$ \__$$ |        $$ |$$$/ $$ |/$$$$$$$ |$$ |  $$ |   //
+//  $$ |      $$ |$$    $$ |$$    $$ |        $$ | $/  $$ |$$    $$ |$$ |  $$ |   //
+//  $$/       $$/  $$$$$$$/  $$$$$$$ |        $$/      $$/  $$$$$$$/ $$/   $$/    //
+//                          /  \__$$ |                                            //
+//                          $$    $$/                                             //
+//                           $$$$$$/                                              //
+//                                                                                //
+//                            By: K1ngmar and rvan-mee                            //
+// ****************************************************************************** //
+
+#include <play-man/gameboy/savestate/SaveState.hpp>
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace GameBoy {
+
+    /*     SaveStateWriter     */
+
+    SaveStateWriter::SaveStateWriter(std::vector<uint8_t>& _buffer) : buffer(_buffer)
+    {
+        buffer.clear();
+        Write(saveStateMagic);
+        Write(saveStateVersion);
+    }
+
+    void    SaveStateWriter::BeginSection(const uint32_t id)
+    {
+        Write(id);
+        sectionStart = buffer.size();
+        Write(uint32_t(0)); // The size is filled in by EndSection.
+    }
+
+    void    SaveStateWriter::EndSection()
+    {
+        const uint32_t size = static_cast<uint32_t>(buffer.size() - sectionStart - sizeof(uint32_t));
+
+        std::memcpy(buffer.data() + sectionStart, &size, sizeof(size));
+    }
+
+    void    SaveStateWriter::WriteBytes(const void* data, const size_t size)
+    {
+        const size_t offset = buffer.size();
+
+        buffer.resize(offset + size);
+        std::memcpy(buffer.data() + offset, data, size);
+    }
+
+    /*     SaveStateReader     */
+
+    SaveStateReader::SaveStateReader(std::span<const uint8_t> _data) noexcept(false) : data(_data), sectionEnd(_data.size())
+    {
+        if (Read<uint32_t>() != saveStateMagic)
+            throw std::runtime_error("Not a save state");
+
+        const uint32_t version = Read<uint32_t>();
+        if (version != saveStateVersion)
+        {
+            throw std::runtime_error("Unsupported save state version: " + std::to_string(version) +
+                                     ", expected: " + std::to_string(saveStateVersion));
+        }
+    }
+
+    void    SaveStateReader::BeginSection(const uint32_t id) noexcept(false)
+    {
+        sectionEnd = data.size();
+        if (Read<uint32_t>() != id)
+            throw std::runtime_error("Save state section missing or out of order");
+
+        const uint32_t size = Read<uint32_t>();
+        if (size > data.size() - position)
+            throw std::runtime_error("Save state section exceeds the end of the data");
+        sectionEnd = position + size;
+    }
+
+    void    SaveStateReader::EndSection() noexcept(false)
+    {
+        if (position != sectionEnd)
+            throw std::runtime_error("Save state section size does not match its contents");
+        sectionEnd = data.size();
+    }
+
+    void    SaveStateReader::Finish() noexcept(false)
+    {
+        if (position != data.size())
+            throw std::runtime_error("Save state has data after its last section");
+    }
+
+    void    SaveStateReader::ReadBytes(void* destination, const size_t size) noexcept(false)
+    {
+        if (size > sectionEnd - position)
+            throw std::runtime_error("Save state section is too short");
+
+        std::memcpy(destination, data.data() + position, size);
+        position += size;
+    }
+
+    bool    SaveStateReader::ReadBool() noexcept(false)
+    {
+        const uint8_t value = Read<uint8_t>();
+
+        if (value > 1)
+            throw std::runtime_error("Save state contains an invalid bool: " + std::to_string(value));
+        return value == 1;
+    }
+
+    void    SaveStateReader::Skip(const size_t size) noexcept(false)
+    {
+        if (size > sectionEnd - position)
+            throw std::runtime_error("Save state section is too short");
+        position += size;
+    }
+
+}
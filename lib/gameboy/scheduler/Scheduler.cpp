@@ -0,0 +1,138 @@
+// ****************************************************************************** //
+//   _______   __                              __       __                        //
+//  /       \ /  |                            /  \     /  |                       //
+//  $$$$$$$  |$$ |  ______   __    __         $$  \   /$$ |  ______   _______     //
+//  $$ |__$$ |$$ | /      \ /  |  /  | ______ $$$  \ /$$$ | /      \ /       \    //
+//  $$    $$/ $$ | $$$$$$  |$$ |  $$ |/      |$$$$  /$$$$ | $$$$$$  |$$$$$$$  |   //
+//  $$$$$$$/  $$ | /    $$ |$$ |  $$ |$$$$$$/ $$ $$ $$/$$ | /    $$ |$$ |  $$ |   //
+//  $$ |      $$ |/$$$$$$$ |$$ \__$$ |        $$ |$$$/ $$ |/$$$$$$$ |$$ |  $$ |   //
+//  $$ |      $$ |$$    $$ |$$    $$ |        $$ | $/  $$ |$$    $$ |$$ |  $$ |   //
+//  $$/       $$/  $$$$$$$/  $$$$$$$ |        $$/      $$/  $$$$$$$/ $$/   $$/    //
+//                          /  \__$$ |                                            //
+//                          $$    $$/                                             //
+//                           $$$$$$/                                              //
+//                                                                                //
+//                            By: K1ngmar and rvan-mee                            //
+// ****************************************************************************** //
+
+#include <play-man/gameboy/scheduler/Scheduler.hpp>
+
+#include <algorithm>
+
+/**
+ * @brief Orders the queue as a min heap, the standard heap functions build a max heap.
+ */
+static constexpr auto laterDeadline = [](const auto& lhs, const auto& rhs)
+{
+	return lhs.deadline > rhs.deadline;
+};
+
+namespace GameBoy
+{
+	Scheduler::Scheduler()
+	{
+		deadlines.fill(notScheduled);
+		queue.reserve(numberOfSchedulerEvents * 4);
+	}
+
+	void Scheduler::DropStaleEntries()
+	{
+		while (!queue.empty() && queue.front().deadline != deadlines[queue.front().event])
+		{
+			std::pop_heap(queue.begin(), queue.end(), laterDeadline);
+			queue.pop_back();
+		}
+	}
+
+	void Scheduler::Compact()
+	{
+		queue.clear();
+		for (size_t event = 0; event < numberOfSchedulerEvents; event++)
+		{
+			if (deadlines[event] != notScheduled)
+				queue.push_back(Entry { deadlines[event], static_cast<SchedulerEvent>(event) });
+		}
+		std::make_heap(queue.begin(), queue.end(), laterDeadline);
+	}
+
+	void Scheduler::SetHandler(SchedulerEvent event, EventHandler handler)
+	{
+		handlers[event] = std::move(handler);
+	}
+
+	void Scheduler::Schedule(SchedulerEvent event, size_t deadline)
+	{
+		if (deadlines[event] == deadline)
+			return;
+
+		deadlines[event] = deadline;
+		if (queue.size() >= numberOfSchedulerEvents * 4)
+		{
+			Compact();
+			return;
+		}
+
+		queue.push_back(Entry { deadline, event });
+		std::push_heap(queue.begin(), queue.end(), laterDeadline);
+		DropStaleEntries();
+	}
+
+	void Scheduler::Cancel(SchedulerEvent event)
+	{
+		deadlines[event] = notScheduled;
+		DropStaleEntries();
+	}
+
+	void Scheduler::Clear()
+	{
+		deadlines.fill(notScheduled);
+		queue.clear();
+	}
+
+	void Scheduler::RunDueEvents(size_t now)
+	{
+		while (NextDeadline() <= now)
+		{
+			const Entry entry = queue.front();
+
+			std::pop_heap(queue.begin(), queue.end(), laterDeadline);
+			queue.pop_back();
+			deadlines[entry.event] = notScheduled;
+			DropStaleEntries();
+
+			if (handlers[entry.event])
+				handlers[entry.event](entry.deadline);
+		}
+	}
+
+	void Scheduler::SaveState(SaveStateWriter& writer) const
+	{
+		writer.BeginSection(MakeSaveStateId("SCHD"));
+		for (size_t event = 0; event < numberOfSchedulerEvents; event++)
+		{
+			writer.Write(static_cast<uint64_t>(deadlines[event]));
+		}
+		writer.EndSection();
+	}
+
+	void Scheduler::LoadState(SaveStateReader& reader) noexcept(false)
+	{
+		Clear();
+		reader.BeginSection(MakeSaveStateId("SCHD"));
+		for (size_t event = 0; event < numberOfSchedulerEvents; event++)
+		{
+			const size_t deadline = static_cast<size_t>(reader.Read<uint64_t>());
+
+			if (deadline != notScheduled)
+				Schedule(static_cast<SchedulerEvent>(event), deadline);
+		}
+		reader.EndSection();
+	}
+
+	void Scheduler::ValidateState(SaveStateReader& reader) const noexcept(false)
+	{
+		reader.BeginSection(MakeSaveStateId("SCHD"));
+		reader.Skip(numberOfSchedulerEvents * sizeof(uint64_t));
+		reader.EndSection();
+	}
+}
@@ -0,0 +1,162 @@
+// ****************************************************************************** //
+//   _______   __                              __       __                        //
+//  /       \ /  |                            /  \     /  |                       //
+//  $$$$$$$  |$$ |  ______   __    __         $$  \   /$$ |  ______   _______     //
+//  $$ |__$$ |$$ | /      \ /  |  /  | ______ $$$  \ /$$$ | /      \ /       \    //
+//  $$    $$/ $$ | $$$$$$  |$$ |  $$ |/      |$$$$  /$$$$ | $$$$$$  |$$$$$$$  |   //
+//  $$$$$$$/  $$ | /    $$ |$$ |  $$ |$$$$$$/ $$ $$ $$/$$ | /    $$ |$$ |  $$ |   //
+//  $$ |      $$ |/$$$$$$$ |$$ \__$$ |        $$ |$$$/ $$ |/$$$$$$$ |$$ |  $$ |   //
+//  $$ |      $$ |$$    $$ |$$    $$ |        $$ | $/  $$ |$$    $$ |$$ |  $$ |   //
+//  $$/       $$/  $$$$$$$/  $$$$$$$ |        $$/      $$/  $$$$$$$/ $$/   $$/    //
+//                          /  \__$$ |                                            //
+//                          $$    $$/                                             //
+//                           $$$$$$/                                              //
+//                                                                                //
+//                            By: K1ngmar and rvan-mee                            //
+// ****************************************************************************** //
+
+#include <play-man/gameboy/timer/Timer.hpp>
+#include <play-man/gameboy/memory/MemoryBusDefines.hpp>
+
+#include <assert.h>
+
+namespace GameBoy
+{
+	Timer::Timer(CpuCore& _core, Scheduler& _scheduler, const size_t& _cycles)
+		: core(_core), scheduler(_scheduler), cycles(_cycles), lastSynchronized(_cycles)
+	{
+		scheduler.SetHandler(SchedulerEvent::TimerOverflow, [this](size_t)
+		{
+			Synchronize();
+			ScheduleOverflow();
+		});
+	}
+
+	uint8_t Timer::CounterShift() const
+	{
+		// 4096 Hz, 262144 Hz, 65536 Hz and 16384 Hz.
+		constexpr uint8_t shifts[] = { 8, 2, 4, 6 };
+
+		return shifts[timerControl & 0b11];
+	}
+
+	void Timer::IncrementTimerCounter(size_t increments)
+	{
+		const size_t untilOverflow = 0x100 - timerCounter;
+
+		if (increments < untilOverflow)
+		{
+			timerCounter += static_cast<uint8_t>(increments);
+			return;
+		}
+
+		// After the first overflow TIMA counts from TMA, overflowing every (0x100 - TMA) increments.
+		const size_t reloadPeriod = 0x100 - timerModulo;
+
+		timerCounter = static_cast<uint8_t>(timerModulo + (increments - untilOverflow) % reloadPeriod);
+		core.RequestInterrupt(Interrupt::Timer);
+	}
+
+	void Timer::Synchronize()
+	{
+		const size_t passed = cycles - lastSynchronized;
+
+		if (IsEnabled())
+		{
+			const uint8_t shift = CounterShift();
+			IncrementTimerCounter(((counter + passed) >> shift) - (counter >> shift));
+		}
+		counter = static_cast<uint16_t>(counter + passed);
+		lastSynchronized = cycles;
+	}
+
+	void Timer::ScheduleOverflow()
+	{
+		if (!IsEnabled())
+		{
+			scheduler.Cancel(SchedulerEvent::TimerOverflow);
+			return;
+		}
+
+		// Cycles until the falling edge of the increment that overflows TIMA.
+		const uint8_t shift = CounterShift();
+		const size_t overflowCounter = ((static_cast<size_t>(counter) >> shift) + (0x100 - timerCounter)) << shift;
+
+		scheduler.Schedule(SchedulerEvent::TimerOverflow, lastSynchronized + (overflowCounter - counter));
+	}
+
+	uint8_t Timer::ReadByte(const uint16_t address)
+	{
+		Synchronize();
+		switch (address)
+		{
+			case dividerAddress:
+				return static_cast<uint8_t>(counter >> 6);
+			case timerCounterAddress:
+				return timerCounter;
+			case timerModuloAddress:
+				return timerModulo;
+			case timerControlAddress:
+				return timerControl | 0b1111'1000; // The unused bits always read as 1.
+			default:
+				assert(false && "Not a timer register");
+				return 0xFF;
+		}
+	}
+
+	void Timer::WriteByte(const uint16_t address, const uint8_t value)
+	{
+		Synchronize();
+		switch (address)
+		{
+			case dividerAddress:
+				// Resetting the counter is a falling edge when the bit TIMA watches was set.
+				if (IsEnabled() && (counter & (1 << (CounterShift() - 1))) != 0)
+					IncrementTimerCounter(1);
+				counter = 0;
+				break;
+			case timerCounterAddress:
+				timerCounter = value;
+				break;
+			case timerModuloAddress:
+				timerModulo = value;
+				break;
+			case timerControlAddress:
+				timerControl = value & 0b111;
+				break;
+			default:
+				assert(false && "Not a timer register");
+				break;
+		}
+		ScheduleOverflow();
+	}
+
+	void Timer::SaveState(SaveStateWriter& writer) const
+	{
+		writer.BeginSection(MakeSaveStateId("TIMR"));
+		writer.Write(static_cast<uint64_t>(lastSynchronized));
+		writer.Write(counter);
+		writer.Write(timerCounter);
+		writer.Write(timerModulo);
+		writer.Write(timerControl);
+		writer.EndSection();
+	}
+
+	void Timer::LoadState(SaveStateReader& reader) noexcept(false)
+	{
+		reader.BeginSection(MakeSaveStateId("TIMR"));
+		lastSynchronized = static_cast<size_t>(reader.Read<uint64_t>());
+		reader.Read(counter);
+		reader.Read(timerCounter);
+		reader.Read(timerModulo);
+		reader.Read(timerControl);
+		reader.EndSection();
+	}
+
+	void Timer::ValidateState(SaveStateReader& reader) const noexcept(false)
+	{
+		reader.BeginSection(MakeSaveStateId("TIMR"));
+		reader.Skip(sizeof(uint64_t) + sizeof(counter) + sizeof(timerCounter) + sizeof(timerModulo) + sizeof(timerControl));
+		reader.EndSection();
+	}
+}
@@ -20,6 +20,8 @@
 PlayManSettings::PlayManSettings()
 	: logLevel(defaultLogLevel)
 	, logDirectory(defaultLogDirectory)
+	, timingAccuracy(defaultTimingAccuracy)
+	, saveFlushIntervalFrames(defaultSaveFlushIntervalFrames)
 {}
 
 PlayManSettings::PlayManSettings(const PlayManSettings& rhs)
@@ -31,6 +33,8 @@ PlayManSettings& PlayManSettings::operator = (const PlayManSettings& rhs)
 {
 	logLevel = rhs.logLevel;
 	logDirectory = rhs.logDirectory;
+	timingAccuracy = rhs.timingAccuracy;
+	saveFlushIntervalFrames = rhs.saveFlushIntervalFrames;
 	return *this;
 }
 
@@ -38,7 +42,9 @@ void to_json(nlohmann::json& j, const PlayManSettings& p)
 {
 	j = nlohmann::json {
 		{"logLevel", p.logLevel},
-		{"logDirectory", p.logDirectory}
+		{"logDirectory", p.logDirectory},
+		{"timingAccuracy", p.timingAccuracy},
+		{"saveFlushIntervalFrames", p.saveFlushIntervalFrames}
 	};
 }
 
@@ -46,4 +52,6 @@ void from_json(const nlohmann::json& j, PlayManSettings& p)
 {
 	p.logLevel = j.value<Logger::LogLevel>("logLevel", PlayManSettings::defaultLogLevel);
 	p.logDirectory = j.value<std::filesystem::path>("logDirectory", PlayManSettings::defaultLogDirectory);
+	p.timingAccuracy = j.value<TimingAccuracy>("timingAccuracy", PlayManSettings::defaultTimingAccuracy);
+	p.saveFlushIntervalFrames = j.value<uint32_t>("saveFlushIntervalFrames", PlayManSettings::defaultSaveFlushIntervalFrames);
 }
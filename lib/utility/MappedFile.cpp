@@ -0,0 +1,240 @@
+// ****************************************************************************** //
+//   _______   __                              __       __                        //
+//  /       \ /  |                            /  \     /  |                       //
+//  $$$$$$$  |$$ |  ______   __    __         $$  \   /$$ |  ______   _______     //
+//  $$ |__$$ |$$ | /      \ /  |  /  | ______ $$$  \ /$$$ | /      \ /       \    //
+//  $$    $$/ $$ | $$$$$$  |$$ |  $$ |/      |$$$$  /$$$$ | $$$$$$  |$$$$$$$  |   //
+//  $$$$$$$/  $$ | /    $$ |$$ |  $$ |$$$$$$/ $$ $$ $$/$$ | /    $$ |$$ |  $$ |   //
+//  $$ |      $$ |/$$$$$$$ |$$ \__$$ |        $$ |$$$/ $$ |/$$$$$$$ |$$ |  $$ |   //
+//  $$ |      $$ |$$    $$ |$$    $$ |        $$ | $/  $$ |$$    $$ |$$ |  $$ |   //
+//  $$/       $$/  $$$$$$$/  $$$$$$$ |        $$/      $$/  $$$$$$$/ $$/   $$/    //
+//                          /  \__$$ |                                            //
+//                          $$    $$/                                             //
+//                           $$$$$$/                                              //
+//                                                                                //
+//                            By: K1ngmar and rvan-mee                            //
+// ****************************************************************************** //
+
+#include <play-man/utility/MappedFile.hpp>
+#include <play-man/utility/UtilFunc.hpp>
+
+#include <stdexcept>
+#include <utility>
+
+#if defined(__linux__) || defined(__APPLE__)
+	#include <fcntl.h>
+	#include <sys/file.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+	#define PLAY_MAN_HAS_MMAP
+#else
+	#include <fstream>
+#endif
+
+namespace Utility
+{
+	static std::runtime_error OpenError(const std::filesystem::path& filePath)
+	{
+		return std::runtime_error("Failed to open file: " + filePath.string() + "\nError: " + ErrnoToString() + "\n");
+	}
+
+	MappedFile::MappedFile(const std::filesystem::path& filePath) noexcept(false)
+	{
+	#if defined(PLAY_MAN_HAS_MMAP)
+		const int fd = open(filePath.c_str(), O_RDONLY);
+		if (fd == -1)
+		{
+			throw OpenError(filePath);
+		}
+
+		struct stat fileInfo;
+		if (fstat(fd, &fileInfo) == -1)
+		{
+			close(fd);
+			throw OpenError(filePath);
+		}
+
+		mappedSize = static_cast<size_t>(fileInfo.st_size);
+		if (mappedSize > 0)
+		{
+			void* mapping = mmap(nullptr, mappedSize, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (mapping == MAP_FAILED)
+			{
+				close(fd);
+				throw OpenError(filePath);
+			}
+
+			// The whole file is going to be needed anyway, so start reading it in right away.
+			posix_madvise(mapping, mappedSize, POSIX_MADV_WILLNEED);
+			mappedData = static_cast<const uint8_t*>(mapping);
+		}
+		// The mapping keeps its own reference to the file.
+		close(fd);
+	#else
+		std::ifstream file(filePath, std::ios::binary);
+		if (!file.good())
+		{
+			throw OpenError(filePath);
+		}
+
+		fallbackData.resize(std::filesystem::file_size(filePath));
+		file.read(reinterpret_cast<char*>(fallbackData.data()), fallbackData.size());
+		mappedData = fallbackData.data();
+		mappedSize = fallbackData.size();
+	#endif
+	}
+
+	MappedFile::~MappedFile()
+	{
+		Unmap();
+	}
+
+	MappedFile::MappedFile(MappedFile&& other) noexcept
+	{
+		*this = std::move(other);
+	}
+
+	MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+	{
+		if (this == &other)
+			return *this;
+
+		Unmap();
+		// Moving a vector keeps its buffer, so mappedData stays valid in both cases.
+		fallbackData = std::move(other.fallbackData);
+		mappedData = std::exchange(other.mappedData, nullptr);
+		mappedSize = std::exchange(other.mappedSize, 0);
+		return *this;
+	}
+
+	void MappedFile::Unmap()
+	{
+	#if defined(PLAY_MAN_HAS_MMAP)
+		if (IsMapped())
+		{
+			munmap(const_cast<uint8_t*>(mappedData), mappedSize);
+		}
+	#endif
+		fallbackData.clear();
+		mappedData = nullptr;
+		mappedSize = 0;
+	}
+
+	/*     WritableMappedFile     */
+
+	WritableMappedFile::WritableMappedFile(const std::filesystem::path& filePath, size_t size) noexcept(false)
+	{
+	#if defined(PLAY_MAN_HAS_MMAP)
+		const int fd = open(filePath.c_str(), O_RDWR | O_CREAT, 0644);
+		if (fd == -1)
+		{
+			throw OpenError(filePath);
+		}
+
+		// Two mappings of the same file would silently overwrite each other's data.
+		if (flock(fd, LOCK_EX | LOCK_NB) == -1)
+		{
+			close(fd);
+			throw std::runtime_error("File is already in use: " + filePath.string() + "\n");
+		}
+
+		struct stat fileInfo;
+		if (fstat(fd, &fileInfo) == -1 ||
+			(static_cast<size_t>(fileInfo.st_size) < size && ftruncate(fd, static_cast<off_t>(size)) == -1))
+		{
+			close(fd);
+			throw OpenError(filePath);
+		}
+
+		mappedSize = size;
+		if (mappedSize > 0)
+		{
+			void* mapping = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+			if (mapping == MAP_FAILED)
+			{
+				close(fd);
+				throw OpenError(filePath);
+			}
+			mappedData = static_cast<uint8_t*>(mapping);
+		}
+		// Closing the file would release the lock, it is kept open until the data is unmapped.
+		lockedFile = fd;
+	#else
+		fallbackData.resize(size);
+		fallbackPath = filePath;
+
+		std::ifstream file(filePath, std::ios::binary);
+		if (file.good())
+		{
+			file.read(reinterpret_cast<char*>(fallbackData.data()), fallbackData.size());
+		}
+		else if (!std::ofstream(filePath, std::ios::binary).good())
+		{
+			throw OpenError(filePath);
+		}
+		mappedData = fallbackData.data();
+		mappedSize = fallbackData.size();
+	#endif
+	}
+
+	WritableMappedFile::~WritableMappedFile()
+	{
+		Unmap();
+	}
+
+	WritableMappedFile::WritableMappedFile(WritableMappedFile&& other) noexcept
+	{
+		*this = std::move(other);
+	}
+
+	WritableMappedFile& WritableMappedFile::operator=(WritableMappedFile&& other) noexcept
+	{
+		if (this == &other)
+			return *this;
+
+		Unmap();
+		// Moving a vector keeps its buffer, so mappedData stays valid in both cases.
+		fallbackData = std::move(other.fallbackData);
+		fallbackPath = std::move(other.fallbackPath);
+		mappedData = std::exchange(other.mappedData, nullptr);
+		mappedSize = std::exchange(other.mappedSize, 0);
+		lockedFile = std::exchange(other.lockedFile, -1);
+		return *this;
+	}
+
+	void WritableMappedFile::Flush(bool wait)
+	{
+		if (mappedData == nullptr)
+			return ;
+
+	#if defined(PLAY_MAN_HAS_MMAP)
+		msync(mappedData, mappedSize, wait ? MS_SYNC : MS_ASYNC);
+	#else
+		(void)wait;
+		std::ofstream file(fallbackPath, std::ios::binary | std::ios::in | std::ios::out);
+		file.write(reinterpret_cast<const char*>(fallbackData.data()), fallbackData.size());
+	#endif
+	}
+
+	void WritableMappedFile::Unmap()
+	{
+		Flush(true);
+	#if defined(PLAY_MAN_HAS_MMAP)
+		if (IsMapped())
+		{
+			munmap(mappedData, mappedSize);
+		}
+		if (lockedFile != -1)
+		{
+			close(lockedFile);
+		}
+	#endif
+		lockedFile = -1;
+		fallbackData.clear();
+		fallbackPath.clear();
+		mappedData = nullptr;
+		mappedSize = 0;
+	}
+
+} /* namespace Utility */
@@ -20,8 +20,20 @@
 #include <play-man/gameboy/opcodes/Opcodes.hpp>
 #include <play-man/gameboy/cpu/Cpu.hpp>
 #include <play-man/logger/Logger.hpp>
+#include <csignal>
 #include <iostream>
 
+/**
+ * @brief Set by SIGINT/SIGTERM, the emulation loop stops and the save file is written back.
+ */
+static volatile std::sig_atomic_t shutdownRequested = 0;
+
+static void RequestShutdown(int signal)
+{
+	(void)signal;
+	shutdownRequested = 1;
+}
+
 int main(int argc, char** argv)
 {
 	(void)argc;
@@ -35,14 +47,37 @@ int main(int argc, char** argv)
 
         std::cout << *cartridge << std::endl;
 
+        // Battery backed RAM is kept in a save file next to the ROM.
+        if (cartridge->HasBattery())
+        {
+            try
+            {
+                cartridge->AttachSaveFile(std::filesystem::path(cartridge->GetFilePath()).replace_extension(".sav"));
+            }
+            catch (const std::exception& e)
+            {
+                LOG_ERROR("Running without a save file, the cartridge RAM will not persist: " + std::string(e.what()));
+            }
+        }
+
+        const auto settings = PlayManSettings::ReadFromFile("PlayManSettings.json");
         GameBoy::Cpu cpu(cartridge);
 
-        while (true)
+        cpu.SetTimingAccuracy(settings->timingAccuracy);
+
+        std::signal(SIGINT, RequestShutdown);
+        std::signal(SIGTERM, RequestShutdown);
+
+        for (uint32_t frame = 1; !shutdownRequested; frame++)
         {
-            cpu.FetchInstruction();
-            cpu.ExecuteInstruction();
+            cpu.RunFor(GameBoy::machineCyclesPerFrame);
+
+            if (settings->saveFlushIntervalFrames != 0 && frame % settings->saveFlushIntervalFrames == 0)
+                cartridge->FlushSaveFile();
         }
 
+        LOG_INFO("Shutting down, writing back the save file");
+        cartridge->FlushSaveFile(true);
         return 0;
     }
     else
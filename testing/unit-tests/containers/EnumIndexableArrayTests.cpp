@@ -28,4 +28,17 @@ TEST_CASE("Enum indexable array []")
 
 	REQUIRE(array[IndexEnum::firstElem] == "first");
 	REQUIRE(array[IndexEnum::secondElem] == "second");
-}
\ No newline at end of file
+}
+
+TEST_CASE("Enum indexable array constexpr")
+{
+	constexpr auto array = []()
+	{
+		EnumIndexableArray<IndexEnum, int, 2> result {};
+		result[IndexEnum::secondElem] = 42;
+		return result;
+	}();
+
+	STATIC_REQUIRE(array[IndexEnum::firstElem] == 0);
+	STATIC_REQUIRE(array.at(IndexEnum::secondElem) == 42);
+}
@@ -0,0 +1,90 @@
+#include <catch2/catch_test_macros.hpp>
+#include "play-man/gameboy/cpu/AluTables.hpp"
+#include "play-man/gameboy/cpu/CpuCore.hpp"
+
+namespace
+{
+	constexpr uint8_t zero = 0x80;
+	constexpr uint8_t sub = 0x40;
+	constexpr uint8_t halfCarry = 0x20;
+	constexpr uint8_t carry = 0x10;
+
+	uint8_t LazyFlags(GameBoy::LazyFlagOperation operation, uint8_t base, uint8_t operand, uint8_t result, uint8_t carryIn)
+	{
+		GameBoy::CpuCore core;
+
+		core.SetFlagsLazy(operation, base, operand, result, carryIn);
+		return core.ComputeFlags();
+	}
+}
+
+TEST_CASE("ALU tables match the increment and decrement flag rules for every value")
+{
+	size_t mismatches = 0;
+
+	for (uint32_t value = 0; value <= 0xFF; value++)
+	{
+		for (uint8_t carryIn = 0; carryIn <= 1; carryIn++)
+		{
+			const uint8_t incremented = static_cast<uint8_t>(value + 1);
+			const uint8_t incrementExpected = (incremented == 0 ? zero : 0)
+				| ((value & 0xF) == 0xF ? halfCarry : 0)
+				| (carryIn ? carry : 0);
+
+			if (LazyFlags(GameBoy::LazyFlagOperation::Increment, value, 1, incremented, carryIn) != incrementExpected)
+				mismatches++;
+
+			const uint8_t decremented = static_cast<uint8_t>(value - 1);
+			const uint8_t decrementExpected = (decremented == 0 ? zero : 0) | sub
+				| ((value & 0xF) == 0x0 ? halfCarry : 0)
+				| (carryIn ? carry : 0);
+
+			if (LazyFlags(GameBoy::LazyFlagOperation::Decrement, value, 1, decremented, carryIn) != decrementExpected)
+				mismatches++;
+		}
+	}
+	REQUIRE(mismatches == 0);
+}
+
+TEST_CASE("Decimal adjust table matches the DAA algorithm for every input")
+{
+	size_t mismatches = 0;
+
+	for (uint32_t a = 0; a <= 0xFF; a++)
+	{
+		for (uint8_t flags = 0; flags <= 0x70; flags += 0x10)
+		{
+			const bool isSub = flags & sub;
+			uint8_t result = a;
+			bool carryOut = false;
+
+			if (isSub)
+			{
+				if (flags & carry)
+				{
+					result -= 0x60;
+					carryOut = true;
+				}
+				if (flags & halfCarry)
+					result -= 0x06;
+			}
+			else
+			{
+				if ((flags & carry) || a > 0x99)
+				{
+					result += 0x60;
+					carryOut = true;
+				}
+				if ((flags & halfCarry) || (a & 0xF) > 0x09)
+					result += 0x06;
+			}
+
+			const uint8_t expectedFlags = (result == 0 ? zero : 0) | (isSub ? sub : 0) | (carryOut ? carry : 0);
+			const uint16_t expected = static_cast<uint16_t>((result << 8) | expectedFlags);
+
+			if (GameBoy::AluTables::decimalAdjust[GameBoy::AluTables::DecimalAdjustIndex(a, flags)] != expected)
+				mismatches++;
+		}
+	}
+	REQUIRE(mismatches == 0);
+}
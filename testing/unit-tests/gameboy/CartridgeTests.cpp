@@ -0,0 +1,227 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch_test_macros.hpp>
+#include "play-man/gameboy/cartridge/Cartridge.hpp"
+#include "play-man/gameboy/cartridge/RomCache.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+#define GB_ROM_PATH "./test-data/custom_gb_test_roms/"
+
+TEST_CASE("Cartridges loading the same ROM share it")
+{
+	auto first = GameBoy::MakeCartridge(GB_ROM_PATH "test_rom.gb");
+	auto second = GameBoy::MakeCartridge(GB_ROM_PATH "test_rom.gb");
+
+	REQUIRE(&first->GetRom() == &second->GetRom());
+	REQUIRE(GameBoy::LoadSharedRom(GB_ROM_PATH "test_rom.gb").get() == &first->GetRom());
+}
+
+TEST_CASE("Different ROMs are not shared")
+{
+	auto first = GameBoy::LoadSharedRom(GB_ROM_PATH "test_rom.gb");
+	auto second = GameBoy::LoadSharedRom(GB_ROM_PATH "jump_relative_test.gb");
+
+	REQUIRE(first != second);
+}
+
+TEST_CASE("Copies of a ROM at another path are shared")
+{
+	const std::filesystem::path copyPath = std::filesystem::temp_directory_path() / "play-man-rom-cache-copy.gb";
+	std::filesystem::copy_file(GB_ROM_PATH "test_rom.gb", copyPath, std::filesystem::copy_options::overwrite_existing);
+
+	auto first = GameBoy::LoadSharedRom(GB_ROM_PATH "test_rom.gb");
+	auto copy = GameBoy::LoadSharedRom(copyPath.c_str());
+
+	REQUIRE(first == copy);
+	std::filesystem::remove(copyPath);
+}
+
+TEST_CASE("Cartridges sharing a ROM keep their own path")
+{
+	const std::filesystem::path copyPath = std::filesystem::temp_directory_path() / "play-man-rom-cache-path.gb";
+	std::filesystem::copy_file(GB_ROM_PATH "test_rom.gb", copyPath, std::filesystem::copy_options::overwrite_existing);
+
+	auto first = GameBoy::MakeCartridge(GB_ROM_PATH "test_rom.gb");
+	auto copy = GameBoy::MakeCartridge(copyPath.c_str());
+
+	REQUIRE(&first->GetRom() == &copy->GetRom());
+	REQUIRE(first->GetFilePath() == GB_ROM_PATH "test_rom.gb");
+	REQUIRE(copy->GetFilePath() == copyPath);
+	std::filesystem::remove(copyPath);
+}
+
+TEST_CASE("A modified ROM file is loaded again")
+{
+	const std::filesystem::path copyPath = std::filesystem::temp_directory_path() / "play-man-rom-cache-modified.gb";
+	std::filesystem::copy_file(GB_ROM_PATH "test_rom.gb", copyPath, std::filesystem::copy_options::overwrite_existing);
+
+	auto original = GameBoy::LoadSharedRom(copyPath.c_str());
+	const uint8_t modifiedByte = static_cast<uint8_t>(~original->GetData()[0]);
+	{
+		std::fstream file(copyPath, std::ios::binary | std::ios::in | std::ios::out);
+		file.put(static_cast<char>(modifiedByte));
+	}
+	auto modified = GameBoy::LoadSharedRom(copyPath.c_str());
+
+	REQUIRE(original != modified);
+	REQUIRE(modified->GetData()[0] == modifiedByte);
+	std::filesystem::remove(copyPath);
+}
+
+TEST_CASE("Released ROMs do not pile up in the cache")
+{
+	const std::filesystem::path copyPath = std::filesystem::temp_directory_path() / "play-man-rom-cache-released.gb";
+	std::filesystem::copy_file(GB_ROM_PATH "test_rom.gb", copyPath, std::filesystem::copy_options::overwrite_existing);
+
+	size_t cacheSize = 0;
+	for (uint8_t i = 0; i < 8; i++)
+	{
+		// Every iteration loads a ROM with other contents, after the previous one was released.
+		{
+			std::fstream file(copyPath, std::ios::binary | std::ios::in | std::ios::out);
+			file.put(static_cast<char>(i));
+		}
+		auto rom = GameBoy::LoadSharedRom(copyPath.c_str());
+
+		if (i == 0)
+			cacheSize = GameBoy::GetRomCacheSize();
+		REQUIRE(GameBoy::GetRomCacheSize() == cacheSize);
+	}
+	std::filesystem::remove(copyPath);
+}
+
+TEST_CASE("Cartridges sharing a ROM keep their own RAM")
+{
+	// test_rom.gb is a MBC5 cartridge with RAM.
+	auto first = GameBoy::MakeCartridge(GB_ROM_PATH "test_rom.gb");
+	auto second = GameBoy::MakeCartridge(GB_ROM_PATH "test_rom.gb");
+
+	first->WriteByte(0x0000, 0x0A);
+	second->WriteByte(0x0000, 0x0A);
+	first->WriteByte(0xA000, 0x42);
+
+	REQUIRE(first->ReadByte(0xA000) == 0x42);
+	REQUIRE(second->ReadByte(0xA000) == 0x00);
+}
+
+TEST_CASE("Loading a test ROM does not affect cartridges sharing the ROM")
+{
+	auto first = GameBoy::MakeCartridge(GB_ROM_PATH "test_rom.gb");
+	auto second = GameBoy::MakeCartridge(GB_ROM_PATH "test_rom.gb");
+
+	first->LoadTestRom(GB_ROM_PATH "run_for_test.gb");
+
+	REQUIRE(&first->GetRom() != &second->GetRom());
+	REQUIRE(first->ReadByte(0x0000) == 0x06);
+	REQUIRE(second->ReadByte(0x0000) == 0xFF);
+}
+
+TEST_CASE("Cartridges resolve to their concrete mapper")
+{
+	// test_rom.gb is a MBC5 cartridge with RAM.
+	auto cartridge = GameBoy::MakeCartridge(GB_ROM_PATH "test_rom.gb");
+	const GameBoy::CartridgeMapper mapper = cartridge->GetMapper();
+
+	REQUIRE(std::holds_alternative<GameBoy::MBC5Cartridge*>(mapper));
+	REQUIRE(std::get<GameBoy::MBC5Cartridge*>(mapper) == cartridge.get());
+}
+
+TEST_CASE("Writing the control registers remaps the selected banks")
+{
+	// test_rom.gb is a MBC5 cartridge with 64 ROM banks and 4 RAM banks.
+	auto cartridge = GameBoy::MakeCartridge(GB_ROM_PATH "test_rom.gb");
+	const GameBoy::Rom& rom = cartridge->GetRom();
+
+	REQUIRE(cartridge->GetReadPointer(0x0123) == rom.GetBankData(0) + 0x0123);
+	REQUIRE(cartridge->GetReadPointer(0x4123) == rom.GetBankData(1) + 0x0123);
+
+	cartridge->WriteByte(0x2000, 0x2A);
+
+	REQUIRE(cartridge->GetReadPointer(0x4123) == rom.GetBankData(0x2A) + 0x0123);
+	REQUIRE(cartridge->ReadByte(0x4123) == rom.GetBankData(0x2A)[0x0123]);
+
+	// Bank 0x40 does not exist.
+	cartridge->WriteByte(0x2000, 0x40);
+
+	REQUIRE(cartridge->GetReadPointer(0x4123) == nullptr);
+
+	REQUIRE(cartridge->GetWritePointer(0xA000) == nullptr);
+
+	cartridge->WriteByte(0x0000, 0x0A);
+	cartridge->WriteByte(0x4000, 0x02);
+	cartridge->WriteByte(0xA010, 0x42);
+
+	REQUIRE(cartridge->GetWritePointer(0xA000) != nullptr);
+	REQUIRE(cartridge->GetWritePointer(0xA010)[0] == 0x42);
+
+	cartridge->WriteByte(0x4000, 0x01);
+
+	REQUIRE(cartridge->ReadByte(0xA010) == 0x00);
+
+	cartridge->WriteByte(0x4000, 0x02);
+
+	REQUIRE(cartridge->ReadByte(0xA010) == 0x42);
+}
+
+TEST_CASE("Battery backed RAM persists through the save file")
+{
+	// test_rom.gb is a MBC5 cartridge with RAM and a battery, using 4 RAM banks of 8 KiB.
+	const std::filesystem::path saveFile = "battery_ram_test.sav";
+	std::filesystem::remove(saveFile);
+
+	{
+		auto cartridge = GameBoy::MakeCartridge(GB_ROM_PATH "test_rom.gb");
+
+		REQUIRE(cartridge->HasBattery());
+		cartridge->AttachSaveFile(saveFile);
+
+		cartridge->WriteByte(0x0000, 0x0A);
+		cartridge->WriteByte(0x4000, 0x03);
+		cartridge->WriteByte(0xA010, 0x42);
+
+		REQUIRE(cartridge->ReadByte(0xA010) == 0x42);
+		REQUIRE(cartridge->GetWritePointer(0xA010)[0] == 0x42);
+	}
+
+	REQUIRE(std::filesystem::file_size(saveFile) == 4 * 0x2000);
+
+	{
+		auto cartridge = GameBoy::MakeCartridge(GB_ROM_PATH "test_rom.gb");
+		cartridge->AttachSaveFile(saveFile);
+
+		// All of the RAM got replaced by the save file.
+		std::vector<size_t> dirty;
+		cartridge->GetRamDirtyPages().ForEachDirtyPage([&dirty](size_t page) { dirty.push_back(page); });
+		REQUIRE(dirty.size() == 4 * 0x2000 / GameBoy::memoryPageSize);
+
+		cartridge->WriteByte(0x0000, 0x0A);
+		cartridge->WriteByte(0x4000, 0x03);
+
+		REQUIRE(cartridge->ReadByte(0xA010) == 0x42);
+		REQUIRE(cartridge->ReadByte(0xA011) == 0x00);
+	}
+
+	std::filesystem::remove(saveFile);
+}
+
+TEST_CASE("A save file is only used by one cartridge at a time")
+{
+	const std::filesystem::path saveFile = "shared_save_file_test.sav";
+	std::filesystem::remove(saveFile);
+
+	auto other = GameBoy::MakeCartridge(GB_ROM_PATH "test_rom.gb");
+	{
+		auto cartridge = GameBoy::MakeCartridge(GB_ROM_PATH "test_rom.gb");
+		cartridge->AttachSaveFile(saveFile);
+
+		// The other cartridge keeps running on its own RAM.
+		REQUIRE_THROWS_AS(other->AttachSaveFile(saveFile), std::runtime_error);
+		other->WriteByte(0x0000, 0x0A);
+		other->WriteByte(0xA000, 0x42);
+		REQUIRE(other->ReadByte(0xA000) == 0x42);
+	}
+
+	REQUIRE_NOTHROW(other->AttachSaveFile(saveFile));
+	std::filesystem::remove(saveFile);
+}
@@ -0,0 +1,649 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch_test_macros.hpp>
+#include "GameBoyCpuFixture.hpp"
+
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+// run_for_test.gb contains:
+// 0x0000: LD B, 0x05  (2 cycles)
+// 0x0002: INC B       (1 cycle)
+// 0x0003: LD C, 0x10  (2 cycles)
+// 0x0005: ADD A, B    (1 cycle)
+// 0x0006: JR 0x02     (3 cycles)
+// 0x0008: INC B       (skipped)
+// 0x0009: INC B       (skipped)
+// 0x000A: INC A       (1 cycle)
+
+TEST_CASE_METHOD(TestFixtures::GameBoyCpuFixture, "RunFor executes the whole program")
+{
+	LoadTestRom(GB_ROM_PATH "run_for_test.gb");
+
+	const auto numberOfCycles = cpu.RunFor(10);
+
+	REQUIRE(numberOfCycles == 10);
+	REQUIRE(AF.Value() == 0x07'00);
+	REQUIRE(BC.Value() == 0x06'10);
+	REQUIRE(DE.Value() == 0x00'00);
+	REQUIRE(HL.Value() == 0x00'00);
+	REQUIRE(SP.Value() == 0x00'00);
+	REQUIRE(PC.Value() == 0x00'0B);
+	REQUIRE(IE == 0x00);
+}
+
+TEST_CASE_METHOD(TestFixtures::GameBoyCpuFixture, "RunFor finishes the last started instruction")
+{
+	LoadTestRom(GB_ROM_PATH "run_for_test.gb");
+
+	// The first instruction takes 2 cycles, it can not be cut short.
+	auto numberOfCycles = cpu.RunFor(1);
+
+	REQUIRE(numberOfCycles == 2);
+	REQUIRE(BC.Value() == 0x05'00);
+	REQUIRE(PC.Value() == 0x00'02);
+
+	numberOfCycles = cpu.RunFor(3);
+
+	REQUIRE(numberOfCycles == 3);
+	REQUIRE(BC.Value() == 0x06'10);
+	REQUIRE(PC.Value() == 0x00'05);
+}
+
+TEST_CASE_METHOD(TestFixtures::GameBoyCpuFixture, "RunUntil stops once the predicate is met")
+{
+	LoadTestRom(GB_ROM_PATH "run_for_test.gb");
+
+	auto numberOfCycles = cpu.RunUntil([&]() { return PC.Value() == 0x00'0A; });
+
+	REQUIRE(numberOfCycles == 9);
+	REQUIRE(AF.Value() == 0x06'00);
+	REQUIRE(BC.Value() == 0x06'10);
+	REQUIRE(PC.Value() == 0x00'0A);
+
+	// The predicate is checked before the first instruction as well.
+	numberOfCycles = cpu.RunUntil([&]() { return PC.Value() == 0x00'0A; });
+
+	REQUIRE(numberOfCycles == 0);
+	REQUIRE(PC.Value() == 0x00'0A);
+}
+
+TEST_CASE_METHOD(TestFixtures::GameBoyCpuFixture, "RunUntil respects the cycle limit")
+{
+	LoadTestRom(GB_ROM_PATH "run_for_test.gb");
+
+	const auto numberOfCycles = cpu.RunUntil([]() { return false; }, 3);
+
+	REQUIRE(numberOfCycles == 3);
+	REQUIRE(BC.Value() == 0x06'00);
+	REQUIRE(PC.Value() == 0x00'03);
+}
+
+TEST_CASE_METHOD(TestFixtures::GameBoyCpuFixture, "Block cache executes the same instructions as the interpreter")
+{
+	LoadTestRom(GB_ROM_PATH "run_for_test.gb");
+	cpu.SetBlockCacheEnabled(true);
+
+	// Stops in the middle of the first block.
+	auto numberOfCycles = cpu.RunFor(3);
+
+	REQUIRE(numberOfCycles == 3);
+	REQUIRE(BC.Value() == 0x06'00);
+	REQUIRE(PC.Value() == 0x00'03);
+
+	numberOfCycles = cpu.RunFor(7);
+
+	REQUIRE(numberOfCycles == 7);
+	REQUIRE(AF.Value() == 0x07'00);
+	REQUIRE(BC.Value() == 0x06'10);
+	REQUIRE(PC.Value() == 0x00'0B);
+
+	// Replaying the cached blocks gives the same result.
+	LoadTestRom(GB_ROM_PATH "run_for_test.gb");
+	numberOfCycles = cpu.RunUntil([&]() { return PC.Value() == 0x00'0A; });
+
+	REQUIRE(numberOfCycles == 9);
+	REQUIRE(AF.Value() == 0x06'00);
+	REQUIRE(BC.Value() == 0x06'10);
+	REQUIRE(PC.Value() == 0x00'0A);
+}
+
+TEST_CASE_METHOD(TestFixtures::GameBoyCpuFixture, "Block cache notices code written to work RAM")
+{
+	cpu.SetBlockCacheEnabled(true);
+
+	memoryBus.WriteByte(0xC000, 0x04); // INC B
+	memoryBus.WriteByte(0xC001, 0x04); // INC B
+	PC.SetValue(0xC000);
+	cpu.RunFor(2);
+
+	REQUIRE(BC.Value() == 0x02'00);
+
+	memoryBus.WriteByte(0xC001, 0x0C); // INC C
+	PC.SetValue(0xC000);
+	cpu.RunFor(2);
+
+	REQUIRE(BC.Value() == 0x03'01);
+}
+
+TEST_CASE_METHOD(TestFixtures::GameBoyCpuFixture, "Block cache stops a block that overwrites itself")
+{
+	cpu.SetBlockCacheEnabled(true);
+
+	memoryBus.WriteByte(0xC000, 0x3E); // LD A, 0x0C
+	memoryBus.WriteByte(0xC001, 0x0C);
+	memoryBus.WriteByte(0xC002, 0x77); // LD (HL), A
+	memoryBus.WriteByte(0xC003, 0x04); // INC B, overwritten with INC C
+	HL.SetValue(0xC003);
+	PC.SetValue(0xC000);
+
+	const auto numberOfCycles = cpu.RunFor(5);
+
+	REQUIRE(numberOfCycles == 5);
+	REQUIRE(BC.Value() == 0x00'01);
+	REQUIRE(PC.Value() == 0xC0'04);
+}
+
+// hot_loop_test.gb contains:
+// 0x0000: INC B       (1 cycle)
+// 0x0001: INC C       (1 cycle)
+// 0x0002: ADD A, B    (1 cycle)
+// 0x0003: JP 0x0000   (4 cycles)
+
+TEST_CASE_METHOD(TestFixtures::GameBoyCpuFixture, "Block cache keeps executing hot ROM loops like the interpreter")
+{
+	GameBoy::Cpu interpreter(GameBoy::MakeCartridge(GB_ROM_PATH "test_rom.gb"));
+
+	interpreter.LoadTestRom(GB_ROM_PATH "hot_loop_test.gb");
+	LoadTestRom(GB_ROM_PATH "hot_loop_test.gb");
+	cpu.SetBlockCacheEnabled(true);
+
+	// Odd budgets end the loop at every instruction, long ones make the block hot.
+	for (const size_t budget : {1, 2, 4, 6, 11, 76, 600, 3, 1000, 5})
+	{
+		REQUIRE(cpu.RunFor(budget) == interpreter.RunFor(budget));
+		REQUIRE(Registers(cpu) == Registers(interpreter));
+	}
+
+	LoadTestRom(GB_ROM_PATH "hot_loop_test.gb");
+
+	const auto numberOfCycles = cpu.RunFor(7 * 100);
+
+	REQUIRE(numberOfCycles == 7 * 100);
+	REQUIRE(AF.Value() == 0xBA'00);
+	REQUIRE(BC.Value() == 0x64'64);
+	REQUIRE(PC.Value() == 0x00'00);
+}
+
+// jit_alu_loop_test.gb runs the loads, 8 bit ALU operations, INC/DEC and (conditional) jumps of every kind,
+// mixed with instructions that access memory or are prefixed, in a loop of 256 iterations that is restarted forever.
+
+TEST_CASE_METHOD(TestFixtures::GameBoyCpuFixture, "Block cache keeps executing hot ALU loops like the interpreter")
+{
+	GameBoy::Cpu interpreter(GameBoy::MakeCartridge(GB_ROM_PATH "test_rom.gb"));
+
+	interpreter.LoadTestRom(GB_ROM_PATH "jit_alu_loop_test.gb");
+	LoadTestRom(GB_ROM_PATH "jit_alu_loop_test.gb");
+	cpu.SetBlockCacheEnabled(true);
+
+	// Ends inside of every block at some point, long budgets run through the end of the loop several times.
+	for (size_t i = 0; i < 400; i++)
+	{
+		const size_t budget = (i % 7 == 0) ? 5000 + i : i % 13 + 1;
+
+		REQUIRE(cpu.RunFor(budget) == interpreter.RunFor(budget));
+		REQUIRE(cpu.GetCycles() == interpreter.GetCycles());
+		REQUIRE(Registers(cpu) == Registers(interpreter));
+	}
+}
+
+TEST_CASE_METHOD(TestFixtures::GameBoyCpuFixture, "Block cache notices code written to work RAM after it got hot")
+{
+	GameBoy::Cpu interpreter(GameBoy::MakeCartridge(GB_ROM_PATH "test_rom.gb"));
+
+	// 0xC000: INC B       (1 cycle)
+	// 0xC001: INC C       (1 cycle), replaced with INC D
+	// 0xC002: ADD A, B    (1 cycle)
+	// 0xC003: JP 0xC000   (4 cycles)
+	const uint8_t program[] = { 0x04, 0x0C, 0x80, 0xC3, 0x00, 0xC0 };
+
+	for (GameBoy::Cpu* current : {&cpu, &interpreter})
+	{
+		for (uint16_t i = 0; i < sizeof(program); i++)
+			Bus(*current).WriteByte(0xC000 + i, program[i]);
+		ProgramCounter(*current).SetValue(0xC000);
+	}
+	cpu.SetBlockCacheEnabled(true);
+
+	for (const size_t budget : {700, 3, 1000})
+	{
+		REQUIRE(cpu.RunFor(budget) == interpreter.RunFor(budget));
+		REQUIRE(Registers(cpu) == Registers(interpreter));
+	}
+
+	Bus(cpu).WriteByte(0xC001, 0x14);
+	Bus(interpreter).WriteByte(0xC001, 0x14);
+
+	for (const size_t budget : {4, 700, 1000})
+	{
+		REQUIRE(cpu.RunFor(budget) == interpreter.RunFor(budget));
+		REQUIRE(Registers(cpu) == Registers(interpreter));
+	}
+	REQUIRE(DE.Value() != 0x00'00);
+}
+
+TEST_CASE_METHOD(TestFixtures::GameBoyCpuFixture, "Scheduled events run once the cpu reaches their deadline")
+{
+	LoadTestRom(GB_ROM_PATH "run_for_test.gb");
+
+	const size_t start = cpu.GetCycles();
+	std::vector<std::pair<size_t, uint16_t>> fired;
+
+	cpu.GetScheduler().SetHandler(GameBoy::SchedulerEvent::TimerOverflow, [&](size_t deadline)
+	{
+		fired.emplace_back(deadline - start, PC.Value());
+	});
+	cpu.GetScheduler().Schedule(GameBoy::SchedulerEvent::TimerOverflow, start + 4);
+
+	SECTION("Interpreter")
+	{
+	}
+
+	SECTION("Block cache")
+	{
+		cpu.SetBlockCacheEnabled(true);
+	}
+
+	const auto numberOfCycles = cpu.RunFor(10);
+
+	// The instruction crossing the deadline finishes first, LD C, 0x10 ends at cycle 5.
+	REQUIRE(numberOfCycles == 10);
+	REQUIRE(fired == std::vector<std::pair<size_t, uint16_t>> { {4, 0x00'05} });
+	REQUIRE(PC.Value() == 0x00'0B);
+}
+
+TEST_CASE_METHOD(TestFixtures::GameBoyCpuFixture, "Timer interrupt is requested while the cpu runs")
+{
+	LoadTestRom(GB_ROM_PATH "hot_loop_test.gb");
+
+	memoryBus.WriteByte(0xFF04, 0x00); // DIV
+	memoryBus.WriteByte(0xFF05, 0xF0); // TIMA, overflows after 16 increments
+	memoryBus.WriteByte(0xFF07, 0x05); // TAC, enabled and incrementing every 4 cycles
+
+	SECTION("Interpreter")
+	{
+	}
+
+	SECTION("Block cache")
+	{
+		cpu.SetBlockCacheEnabled(true);
+	}
+
+	// Eight loops and the first 4 instructions, one cycle before the overflow.
+	cpu.RunFor(60);
+
+	REQUIRE(IF == 0x00);
+
+	// Two loops later, at cycle 73, TIMA restarted from TMA (0) and counted twice since.
+	cpu.RunFor(10);
+
+	REQUIRE(IF == 0x04);
+	REQUIRE(memoryBus.ReadByte(0xFF05) == 0x02);
+	REQUIRE(memoryBus.ReadByte(0xFF0F) == 0xE4);
+}
+
+TEST_CASE_METHOD(TestFixtures::GameBoyCpuFixture, "HALT skips to the event that wakes the cpu up")
+{
+	memoryBus.WriteByte(0xC000, 0x76); // HALT
+	memoryBus.WriteByte(0xC001, 0x04); // INC B
+	PC.SetValue(0xC000);
+
+	memoryBus.WriteByte(0xFF04, 0x00); // DIV
+	memoryBus.WriteByte(0xFF05, 0xF0); // TIMA, overflows after 64 cycles
+	memoryBus.WriteByte(0xFF07, 0x05); // TAC, enabled and incrementing every 4 cycles
+
+	for (const bool blockCache : {false, true})
+	{
+		DYNAMIC_SECTION((blockCache ? "Block cache" : "Interpreter"))
+		{
+			cpu.SetBlockCacheEnabled(blockCache);
+
+			SECTION("Woken up by the timer interrupt")
+			{
+				IE = 0x04;
+
+				const auto numberOfCycles = cpu.RunUntil([&]() { return BC.Value() == 0x01'00; });
+
+				REQUIRE(numberOfCycles == 64 + 1);
+				REQUIRE(PC.Value() == 0xC0'02);
+			}
+
+			SECTION("Stays halted while the interrupt is disabled")
+			{
+				const auto numberOfCycles = cpu.RunFor(5'000);
+
+				REQUIRE(numberOfCycles == 5'000);
+				REQUIRE(BC.Value() == 0x00'00);
+				REQUIRE(PC.Value() == 0xC0'01);
+				REQUIRE(IF == 0x04);
+			}
+
+			SECTION("Does not halt when an enabled interrupt is already requested")
+			{
+				IE = 0x01;
+				IF = 0x01;
+
+				const auto numberOfCycles = cpu.RunFor(2);
+
+				REQUIRE(numberOfCycles == 2);
+				REQUIRE(BC.Value() == 0x01'00);
+			}
+		}
+	}
+}
+
+TEST_CASE_METHOD(TestFixtures::GameBoyCpuFixture, "HALT outside of Run does not skip past the next event")
+{
+	memoryBus.WriteByte(0xC000, 0x00); // NOP
+	memoryBus.WriteByte(0xC001, 0x00); // NOP
+	PC.SetValue(0xC000);
+
+	// Stops early, in the middle of a slice that would have lasted until the cycle limit.
+	REQUIRE(cpu.RunUntil([&]() { return PC.Value() == 0xC0'01; }) == 1);
+
+	REQUIRE(ExecuteInstruction(GameBoy::OpCode::HALT) == 1);
+}
+
+TEST_CASE_METHOD(TestFixtures::GameBoyCpuFixture, "Block cache fast-forwards loops polling the interrupt flags")
+{
+	GameBoy::Cpu interpreter(GameBoy::MakeCartridge(GB_ROM_PATH "test_rom.gb"));
+
+	// 0xC000: LDH A, (0x0F)  (3 cycles)
+	// 0xC002: AND A, 0x04    (2 cycles)
+	// 0xC004: JP Z, 0xC000   (4 cycles)
+	// 0xC007: INC B          (1 cycle)
+	// 0xC008: JP 0xC008      (4 cycles)
+	const uint8_t program[] = { 0xF0, 0x0F, 0xE6, 0x04, 0xCA, 0x00, 0xC0, 0x04, 0xC3, 0x08, 0xC0 };
+
+	for (GameBoy::Cpu* current : {&cpu, &interpreter})
+	{
+		for (uint16_t i = 0; i < sizeof(program); i++)
+			Bus(*current).WriteByte(0xC000 + i, program[i]);
+		Bus(*current).WriteByte(0xFF04, 0x00); // DIV
+		Bus(*current).WriteByte(0xFF05, 0x00); // TIMA, overflows after 1024 cycles
+		Bus(*current).WriteByte(0xFF07, 0x05); // TAC, enabled and incrementing every 4 cycles
+		ProgramCounter(*current).SetValue(0xC000);
+	}
+	cpu.SetBlockCacheEnabled(true);
+
+	// Budgets ending inside an iteration, up to the overflow and past it.
+	for (const size_t budget : {1, 5, 9, 100, 505, 400, 7, 3})
+	{
+		REQUIRE(cpu.RunFor(budget) == interpreter.RunFor(budget));
+		REQUIRE(cpu.GetCycles() == interpreter.GetCycles());
+		REQUIRE(Registers(cpu) == Registers(interpreter));
+	}
+	REQUIRE(BC.Value() == 0x01'00);
+
+	// Without events the loop never ends, which takes no time at all to skip.
+	Bus(cpu).WriteByte(0xFF07, 0x00);
+	Bus(cpu).WriteByte(0xFF0F, 0x00);
+	PC.SetValue(0xC000);
+
+	REQUIRE(cpu.RunFor(1'000'000'000) >= 1'000'000'000);
+	REQUIRE(PC.Value() < 0xC0'07);
+}
+
+TEST_CASE_METHOD(TestFixtures::GameBoyCpuFixture, "Accurate timing executes the same instructions in the same cycles")
+{
+	GameBoy::Cpu fast(GameBoy::MakeCartridge(GB_ROM_PATH "test_rom.gb"));
+
+	fast.LoadTestRom(GB_ROM_PATH "run_for_test.gb");
+	LoadTestRom(GB_ROM_PATH "run_for_test.gb");
+	cpu.SetTimingAccuracy(TimingAccuracy::Accurate);
+
+	for (const size_t budget : {1, 3, 6, 2})
+	{
+		REQUIRE(cpu.RunFor(budget) == fast.RunFor(budget));
+		REQUIRE(cpu.GetCycles() == fast.GetCycles());
+		REQUIRE(Registers(cpu) == Registers(fast));
+	}
+}
+
+TEST_CASE_METHOD(TestFixtures::GameBoyCpuFixture, "Accurate timing reads the timer in the cycle of the access")
+{
+	// 0xC000: NOP            (1 cycle)
+	// 0xC001: NOP            (1 cycle)
+	// 0xC002: LDH A, (0x05)  (3 cycles, reads TIMA in the last one)
+	// 0xC004: JP 0xC004      (4 cycles)
+	const uint8_t program[] = { 0x00, 0x00, 0xF0, 0x05, 0xC3, 0x04, 0xC0 };
+
+	for (uint16_t i = 0; i < sizeof(program); i++)
+		memoryBus.WriteByte(0xC000 + i, program[i]);
+	PC.SetValue(0xC000);
+
+	memoryBus.WriteByte(0xFF04, 0x00); // DIV
+	memoryBus.WriteByte(0xFF07, 0x05); // TAC, enabled and incrementing every 4 cycles
+	memoryBus.WriteByte(0xFF05, 0x00); // TIMA
+
+	for (const bool accurate : {false, true})
+	{
+		DYNAMIC_SECTION((accurate ? "Accurate" : "Fast"))
+		{
+			cpu.SetTimingAccuracy(accurate ? TimingAccuracy::Accurate : TimingAccuracy::Fast);
+
+			REQUIRE(cpu.RunFor(5) == 5);
+			REQUIRE(cpu.GetCycles() == 5);
+
+			// TIMA increments at cycle 4, the fast timing reads it at the start of the instruction (cycle 2).
+			REQUIRE(AF.HighByte() == (accurate ? 0x01 : 0x00));
+		}
+	}
+}
+
+TEST_CASE_METHOD(TestFixtures::GameBoyCpuFixture, "Accurate timing wakes up from HALT at the same cycle")
+{
+	memoryBus.WriteByte(0xC000, 0x76); // HALT
+	memoryBus.WriteByte(0xC001, 0x04); // INC B
+	PC.SetValue(0xC000);
+	IE = 0x04;
+
+	memoryBus.WriteByte(0xFF04, 0x00); // DIV
+	memoryBus.WriteByte(0xFF05, 0xF0); // TIMA, overflows after 64 cycles
+	memoryBus.WriteByte(0xFF07, 0x05); // TAC, enabled and incrementing every 4 cycles
+
+	cpu.SetTimingAccuracy(TimingAccuracy::Accurate);
+
+	const auto numberOfCycles = cpu.RunUntil([&]() { return BC.Value() == 0x01'00; });
+
+	REQUIRE(numberOfCycles == 64 + 1);
+	REQUIRE(PC.Value() == 0xC0'02);
+}
+
+TEST_CASE_METHOD(TestFixtures::GameBoyCpuFixture, "Loading a save state restores the whole machine")
+{
+	// 0xC000: INC B          (1 cycle)
+	// 0xC001: ADD A, B       (1 cycle, its flags are computed lazily)
+	// 0xC002: LD (HL+), A    (2 cycles)
+	// 0xC003: JP 0xC000      (4 cycles)
+	const uint8_t program[] = { 0x04, 0x80, 0x22, 0xC3, 0x00, 0xC0 };
+
+	for (uint16_t i = 0; i < sizeof(program); i++)
+		memoryBus.WriteByte(0xC000 + i, program[i]);
+	PC.SetValue(0xC000);
+	HL.SetValue(0xC100);
+
+	memoryBus.WriteByte(0xFF04, 0x00); // DIV
+	memoryBus.WriteByte(0xFF05, 0xF0); // TIMA, overflows after 64 cycles
+	memoryBus.WriteByte(0xFF07, 0x05); // TAC, enabled and incrementing every 4 cycles
+
+	// Cartridge RAM bank 2.
+	memoryBus.WriteByte(0x0000, 0x0A);
+	memoryBus.WriteByte(0x4000, 0x02);
+	memoryBus.WriteByte(0xA000, 0x42);
+
+	cpu.RunFor(37);
+
+	std::vector<uint8_t> state;
+	cpu.SaveState(state);
+	const size_t savedCycles = cpu.GetCycles();
+
+	const auto snapshot = [this]()
+	{
+		std::vector<uint8_t> machine = { AF.LowByte(), AF.HighByte(), BC.HighByte(), HL.LowByte(), HL.HighByte(), IF };
+
+		machine.push_back(memoryBus.ReadByte(0xFF05)); // TIMA
+		machine.push_back(memoryBus.ReadByte(0xA000));
+		for (uint16_t address = 0xC100; address < 0xC140; address++)
+			machine.push_back(memoryBus.ReadByte(address));
+		return machine;
+	};
+
+	cpu.RunFor(200);
+	const auto expected = snapshot();
+	const size_t expectedCycles = cpu.GetCycles();
+
+	// Change what the state is going to replace, including the mapped cartridge RAM bank.
+	memoryBus.WriteByte(0xA000, 0x00);
+	memoryBus.WriteByte(0x4000, 0x01);
+	memoryBus.WriteByte(0xC100, 0xFF);
+
+	cpu.LoadState(state);
+	REQUIRE(cpu.GetCycles() == savedCycles);
+	REQUIRE(memoryBus.GetWorkRamDirtyPages().Any());
+
+	cpu.RunFor(200);
+	REQUIRE(cpu.GetCycles() == expectedCycles);
+	REQUIRE(snapshot() == expected);
+}
+
+TEST_CASE_METHOD(TestFixtures::GameBoyCpuFixture, "Invalid save states are rejected")
+{
+	std::vector<uint8_t> state;
+	cpu.SaveState(state);
+
+	REQUIRE_NOTHROW(cpu.LoadState(state));
+
+	SECTION("Truncated")
+	{
+		state.resize(state.size() - 1);
+		REQUIRE_THROWS(cpu.LoadState(state));
+		REQUIRE_THROWS(cpu.LoadState(std::span<const uint8_t>()));
+	}
+
+	SECTION("Different version")
+	{
+		state[4]++;
+		REQUIRE_THROWS(cpu.LoadState(state));
+	}
+
+	SECTION("Different cartridge")
+	{
+		// jump_relative_test.gb is a MBC1 cartridge without RAM.
+		GameBoy::Cpu other(GameBoy::MakeCartridge(GB_ROM_PATH "jump_relative_test.gb"));
+
+		REQUIRE_THROWS(other.LoadState(state));
+	}
+}
+
+/**
+ * @brief Returns the offset of the first field of the section with the given identifier.
+ */
+static size_t FindSaveStateSection(const std::vector<uint8_t>& state, const uint32_t sectionId)
+{
+	// Walk the sections (identifier and size) after the header.
+	size_t position = 2 * sizeof(uint32_t);
+	uint32_t id = 0;
+	uint32_t size = 0;
+
+	while (true)
+	{
+		std::memcpy(&id, state.data() + position, sizeof(id));
+		std::memcpy(&size, state.data() + position + sizeof(id), sizeof(size));
+		position += sizeof(id) + sizeof(size);
+		if (id == sectionId)
+			return position;
+		position += size;
+	}
+}
+
+TEST_CASE_METHOD(TestFixtures::GameBoyCpuFixture, "A rejected save state leaves the machine unchanged")
+{
+	std::vector<uint8_t> state;
+	cpu.SaveState(state);
+
+	// Change every section the state would replace.
+	AF.SetValue(0x1230);
+	PC.SetValue(0xC000);
+	memoryBus.WriteByte(0xFF07, 0x05); // TAC
+	memoryBus.WriteByte(0xC000, 0x42);
+	memoryBus.WriteByte(0x0000, 0x0A);
+	memoryBus.WriteByte(0xA000, 0x24);
+	cpu.RunFor(16);
+
+	std::vector<uint8_t> before;
+	cpu.SaveState(before);
+	const size_t cycles = cpu.GetCycles();
+
+	SECTION("Truncated cartridge section")
+	{
+		state.resize(state.size() - 1);
+	}
+
+	SECTION("Trailing data")
+	{
+		state.push_back(0x00);
+	}
+
+	SECTION("Different cartridge type")
+	{
+		// The type is the first field of the cartridge's section.
+		state[FindSaveStateSection(state, GameBoy::MakeSaveStateId("CART"))]++;
+	}
+
+	SECTION("Corrupted bool of the cpu")
+	{
+		// halted follows the registers, IE, IF and cgbMode.
+		state[FindSaveStateSection(state, GameBoy::MakeSaveStateId("CPU ")) + 6 * sizeof(uint16_t) + 3] = 0x02;
+	}
+
+	SECTION("Corrupted bool of the cartridge")
+	{
+		// The RAM enable of the MBC5 is the last field of the cartridge's section, which is the last section.
+		REQUIRE(state.back() == 0x00);
+		state.back() = 0xFF;
+	}
+
+	REQUIRE_THROWS(cpu.LoadState(state));
+
+	std::vector<uint8_t> after;
+	cpu.SaveState(after);
+	REQUIRE(cpu.GetCycles() == cycles);
+	REQUIRE(after == before);
+}
+
+TEST_CASE("Save states of every mapper can be loaded")
+{
+	const std::filesystem::path romPath = std::filesystem::temp_directory_path() / "play-man-save-state-mapper.gb";
+	constexpr size_t cartridgeTypeIndex = 0x0147;
+
+	for (const auto type : { CartridgeType::ROM_RAM, CartridgeType::MBC1_RAM, CartridgeType::MBC2,
+							 CartridgeType::MBC3_TIMER_RAM_BATTERY, CartridgeType::MBC5_RAM })
+	{
+		// test_rom.gb with another cartridge type in its header.
+		std::filesystem::copy_file(GB_ROM_PATH "test_rom.gb", romPath, std::filesystem::copy_options::overwrite_existing);
+		{
+			std::fstream file(romPath, std::ios::binary | std::ios::in | std::ios::out);
+			file.seekp(cartridgeTypeIndex);
+			file.put(static_cast<char>(type));
+		}
+
+		GameBoy::Cpu cpu(GameBoy::MakeCartridge(romPath.c_str()));
+		std::vector<uint8_t> state;
+
+		cpu.SaveState(state);
+		REQUIRE_NOTHROW(cpu.LoadState(state));
+	}
+	std::filesystem::remove(romPath);
+}
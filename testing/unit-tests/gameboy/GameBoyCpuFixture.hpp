@@ -0,0 +1,120 @@
+
+#pragma once
+
+#include "play-man/gameboy/cpu/Cpu.hpp"
+#include "play-man/gameboy/memory/MemoryBus.hpp"
+
+#include <array>
+#include <iomanip>
+#include <iostream>
+
+#define GB_ROM_PATH "./test-data/custom_gb_test_roms/"
+
+namespace TestFixtures
+{
+	/**
+	 * @brief Cpu running test_rom.gb, shared by every gameboy test that needs access to the cpu internals.
+	 * test_rom.gb is a MBC5 cartridge with 64 ROM banks and 4 RAM banks.
+	 */
+	struct GameBoyCpuFixture
+	{
+		GameBoyCpuFixture()
+			: cpu(GameBoy::MakeCartridge(GB_ROM_PATH "test_rom.gb"))
+			, memoryBus(cpu.memoryBus)
+			, AF(cpu.core.AF)
+			, BC(cpu.core.BC)
+			, DE(cpu.core.DE)
+			, HL(cpu.core.HL)
+			, SP(cpu.core.SP)
+			, PC(cpu.core.PC)
+			, IE(cpu.core.IE)
+			, IF(cpu.core.IF)
+		{
+			ClearRegisters();
+		}
+
+		GameBoy::Cpu 		cpu;
+		GameBoy::MemoryBus& memoryBus;
+		GameBoy::Register&	AF;
+		GameBoy::Register&	BC;
+		GameBoy::Register&	DE;
+		GameBoy::Register&	HL;
+		GameBoy::Register&	SP;
+		GameBoy::Register&	PC;
+		uint8_t&			IE;
+		uint8_t&			IF;
+
+		size_t ExecuteInstruction(GameBoy::OpCode op)
+		{
+			const size_t cycles = cpu.instructions.at(op)(&cpu);
+			cpu.core.MaterializeFlags(); // Inspect the flags the way they look at an instruction boundary.
+			return cycles;
+		}
+
+		size_t ExecuteInstruction(GameBoy::PrefixedOpCode op)
+		{
+			const size_t cycles = cpu.prefixedInstructions.at(op)(&cpu);
+			cpu.core.MaterializeFlags(); // Inspect the flags the way they look at an instruction boundary.
+			return cycles;
+		}
+
+		void LoadTestRom(const char *filePath)
+		{
+			cpu.LoadTestRom(filePath);
+		}
+
+		void ClearRegisters()
+		{
+			AF.SetValue(0x0000);
+			BC.SetValue(0x0000);
+			DE.SetValue(0x0000);
+			HL.SetValue(0x0000);
+			SP.SetValue(0x0000);
+			PC.SetValue(0x0000);
+			IE = 0x00;
+		}
+
+		void PrintRegs()
+		{
+			std::cout << "Register AF: 0x" << std::setfill('0') << std::setw(2) << std::hex << static_cast<uint16_t>(AF.HighByte()) << "'" << std::setfill('0') << std::setw(2) << std::hex << static_cast<uint16_t>(AF.LowByte()) << std::endl;
+			std::cout << "Register BC: 0x" << std::setfill('0') << std::setw(2) << std::hex << static_cast<uint16_t>(BC.HighByte()) << "'" << std::setfill('0') << std::setw(2) << std::hex << static_cast<uint16_t>(BC.LowByte()) << std::endl;
+			std::cout << "Register DE: 0x" << std::setfill('0') << std::setw(2) << std::hex << static_cast<uint16_t>(DE.HighByte()) << "'" << std::setfill('0') << std::setw(2) << std::hex << static_cast<uint16_t>(DE.LowByte()) << std::endl;
+			std::cout << "Register HL: 0x" << std::setfill('0') << std::setw(2) << std::hex << static_cast<uint16_t>(HL.HighByte()) << "'" << std::setfill('0') << std::setw(2) << std::hex << static_cast<uint16_t>(HL.LowByte()) << std::endl;
+			std::cout << "Register SP: 0x" << std::setfill('0') << std::setw(2) << std::hex << static_cast<uint16_t>(SP.HighByte()) << "'" << std::setfill('0') << std::setw(2) << std::hex << static_cast<uint16_t>(SP.LowByte()) << std::endl;
+			std::cout << "Register PC: 0x" << std::setfill('0') << std::setw(2) << std::hex << static_cast<uint16_t>(PC.HighByte()) << "'" << std::setfill('0') << std::setw(2) << std::hex << static_cast<uint16_t>(PC.LowByte()) << std::endl;
+			std::cout << "Register IE: 0x" << std::setfill('0') << std::setw(2) << std::hex << static_cast<uint16_t>(IE) << std::endl;
+		}
+
+		/**
+		 * @brief The memory bus of the cpu.
+		 */
+		static GameBoy::MemoryBus& Bus(GameBoy::Cpu& other)
+		{
+			return other.memoryBus;
+		}
+
+		/**
+		 * @brief The cartridge inserted in the cpu.
+		 */
+		static GameBoy::ACartridge& Cartridge(GameBoy::Cpu& other)
+		{
+			return *other.cartridge;
+		}
+
+		/**
+		 * @brief The program counter of the cpu.
+		 */
+		static GameBoy::Register& ProgramCounter(GameBoy::Cpu& other)
+		{
+			return other.core.PC;
+		}
+
+		/**
+		 * @brief The AF, BC, DE, HL and PC registers of the cpu.
+		 */
+		static std::array<uint16_t, 5> Registers(const GameBoy::Cpu& other)
+		{
+			return { other.core.AF.Value(), other.core.BC.Value(), other.core.DE.Value(), other.core.HL.Value(), other.core.PC.Value() };
+		}
+	};
+}
@@ -1,10 +1,7 @@
 
 #define CATCH_CONFIG_MAIN
 #include <catch2/catch_test_macros.hpp>
-#include "play-man/gameboy/cpu/Cpu.hpp"
-#include "play-man/gameboy/memory/MemoryBus.hpp"
-
-#define GB_ROM_PATH "./test-data/custom_gb_test_roms/"
+#include "GameBoyCpuFixture.hpp"
 
 // Address for the interrupt register 
 constexpr uint16_t interruptAddress = 0xFFFF;
@@ -12,71 +9,6 @@ constexpr uint16_t wRamAddressStart = 0xC000;
 
 constexpr uint8_t immediateData8bit = 0x0F;
 
-namespace TestFixtures
-{
-	/**
-	 * @brief
-	 */
-	struct GameBoyCpuFixture
-	{
-		GameBoyCpuFixture()
-			: cpu(GameBoy::MakeCartridge(GB_ROM_PATH "test_rom.gb"))
-			, memoryBus(cpu.memoryBus)
-			, AF(cpu.core.AF)
-			, BC(cpu.core.BC)
-			, DE(cpu.core.DE)
-			, HL(cpu.core.HL)
-			, SP(cpu.core.SP)
-			, PC(cpu.core.PC)
-			, IE(cpu.core.IE)
-		{
-			ClearRegisters();
-		}
-
-		GameBoy::Cpu 		cpu;
-		GameBoy::MemoryBus& memoryBus;
-		GameBoy::Register&	AF;
-        GameBoy::Register&	BC;
-        GameBoy::Register&	DE;
-        GameBoy::Register&	HL;
-        GameBoy::Register&	SP;
-        GameBoy::Register&	PC;
-        uint8_t&			IE;
-
-		size_t ExecuteInstruction(GameBoy::OpCode op)
-		{
-			return cpu.instructions.at(op)(&cpu);
-		}
-
-		void LoadTestRom(const char *filePath)
-		{
-			cpu.LoadTestRom(filePath);
-		}
-
-		void ClearRegisters()
-		{
-			AF.SetValue(0x0000);
-			BC.SetValue(0x0000);
-			DE.SetValue(0x0000);
-			HL.SetValue(0x0000);
-			SP.SetValue(0x0000);
-			PC.SetValue(0x0000);
-			IE = 0x00;
-		}
-
-		void PrintRegs()
-		{
-			std::cout << "Register AF: " << std::to_string( AF.Value() ) << std::endl;
-			std::cout << "Register BC: " << std::to_string( BC.Value() ) << std::endl;
-			std::cout << "Register DE: " << std::to_string( DE.Value() ) << std::endl;
-			std::cout << "Register HL: " << std::to_string( HL.Value() ) << std::endl;
-			std::cout << "Register SP: " << std::to_string( SP.Value() ) << std::endl;
-			std::cout << "Register PC: " << std::to_string( PC.Value() ) << std::endl;
-			std::cout << "Register IE: " << std::to_string( IE ) << std::endl;
-		}
-	};
-}
-
 TEST_CASE_METHOD(TestFixtures::GameBoyCpuFixture, "Nop, 0x00")
 {
 	const auto pcBefore = PC.Value();
@@ -0,0 +1,221 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch_test_macros.hpp>
+#include "GameBoyCpuFixture.hpp"
+#include "play-man/gameboy/memory/MemoryBusDefines.hpp"
+
+namespace TestFixtures
+{
+	/**
+	 * @brief test_rom.gb is a MBC5 cartridge with 64 ROM banks and 4 RAM banks.
+	 */
+	struct MemoryBusFixture : GameBoyCpuFixture
+	{
+		MemoryBusFixture()
+			: cartridge(Cartridge(cpu))
+		{
+		}
+
+		GameBoy::ACartridge& cartridge;
+
+		void RequireRomMatchesCartridge()
+		{
+			for (uint32_t address = romAddressStart; address <= romBankAddressEnd; address++)
+			{
+				REQUIRE(memoryBus.ReadByte(static_cast<uint16_t>(address)) == cartridge.ReadByte(static_cast<uint16_t>(address)));
+			}
+		}
+	};
+}
+
+TEST_CASE_METHOD(TestFixtures::MemoryBusFixture, "Work RAM is mapped in the page table")
+{
+	memoryBus.WriteByte(0xC000, 0x11);
+	memoryBus.WriteByte(0xC0FF, 0x22);
+	memoryBus.WriteByte(0xC100, 0x33);
+	memoryBus.WriteByte(0xCFFF, 0x44);
+	memoryBus.WriteByte(0xD000, 0x55);
+	memoryBus.WriteByte(0xDFFF, 0x66);
+
+	REQUIRE(memoryBus.ReadByte(0xC000) == 0x11);
+	REQUIRE(memoryBus.ReadByte(0xC0FF) == 0x22);
+	REQUIRE(memoryBus.ReadByte(0xC100) == 0x33);
+	REQUIRE(memoryBus.ReadByte(0xCFFF) == 0x44);
+	REQUIRE(memoryBus.ReadByte(0xD000) == 0x55);
+	REQUIRE(memoryBus.ReadByte(0xDFFF) == 0x66);
+
+	// Outside of CGB mode the switchable bank is always bank 1.
+	memoryBus.SetWorkRamBank(2);
+	REQUIRE(memoryBus.ReadByte(0xD000) == 0x55);
+	REQUIRE(memoryBus.ReadByte(0xDFFF) == 0x66);
+}
+
+TEST_CASE_METHOD(TestFixtures::MemoryBusFixture, "ROM reads through the page table match the cartridge")
+{
+	RequireRomMatchesCartridge();
+
+	// Switching the ROM bank remaps the switchable ROM pages.
+	memoryBus.WriteByte(0x2000, 0x00);
+	RequireRomMatchesCartridge();
+
+	memoryBus.WriteByte(0x2000, 0x05);
+	RequireRomMatchesCartridge();
+
+	memoryBus.WriteByte(0x2000, 0x3F);
+	RequireRomMatchesCartridge();
+}
+
+TEST_CASE_METHOD(TestFixtures::MemoryBusFixture, "Cartridge RAM bank switches remap the external RAM pages")
+{
+	memoryBus.WriteByte(0x0000, 0x0A);
+
+	memoryBus.WriteByte(0x4000, 0x01);
+	memoryBus.WriteByte(0xA000, 0x42);
+	memoryBus.WriteByte(0xBFFF, 0x24);
+	REQUIRE(memoryBus.ReadByte(0xA000) == 0x42);
+	REQUIRE(memoryBus.ReadByte(0xBFFF) == 0x24);
+	REQUIRE(cartridge.ReadByte(0xA000) == 0x42);
+
+	memoryBus.WriteByte(0x4000, 0x00);
+	REQUIRE(memoryBus.ReadByte(0xA000) == 0x00);
+	REQUIRE(memoryBus.ReadByte(0xBFFF) == 0x00);
+
+	memoryBus.WriteByte(0x4000, 0x01);
+	REQUIRE(memoryBus.ReadByte(0xA000) == 0x42);
+	REQUIRE(memoryBus.ReadByte(0xBFFF) == 0x24);
+}
+
+TEST_CASE_METHOD(TestFixtures::MemoryBusFixture, "Only cartridge writes that switch banks invalidate decoded code")
+{
+	memoryBus.WriteByte(0x0000, 0x0A);
+	memoryBus.WriteByte(0x2000, 0x05);
+	memoryBus.WriteByte(0x4000, 0x01);
+
+	uint32_t generation = memoryBus.CodeGeneration();
+	uint32_t writableGeneration = memoryBus.WritableCodeGeneration();
+
+	// Enabling the RAM or selecting the same banks again does not change what is mapped.
+	memoryBus.WriteByte(0x0000, 0x0A);
+	memoryBus.WriteByte(0x2000, 0x05);
+	memoryBus.WriteByte(0x4000, 0x01);
+	REQUIRE(memoryBus.CodeGeneration() == generation);
+	REQUIRE(memoryBus.WritableCodeGeneration() == writableGeneration);
+
+	// ROM bank switches stop the running block, the blocks decoded from RAM stay valid.
+	memoryBus.WriteByte(0x2000, 0x06);
+	REQUIRE(memoryBus.CodeGeneration() != generation);
+	REQUIRE(memoryBus.WritableCodeGeneration() == writableGeneration);
+	RequireRomMatchesCartridge();
+
+	// RAM bank switches invalidate the blocks decoded from RAM.
+	generation = memoryBus.CodeGeneration();
+	memoryBus.WriteByte(0x4000, 0x02);
+	REQUIRE(memoryBus.CodeGeneration() != generation);
+	REQUIRE(memoryBus.WritableCodeGeneration() != writableGeneration);
+}
+
+TEST_CASE_METHOD(TestFixtures::MemoryBusFixture, "Fetches follow the address across pages")
+{
+	memoryBus.WriteByte(0xC0FF, 0x11);
+	memoryBus.WriteByte(0xC100, 0x22);
+	memoryBus.WriteByte(0xD000, 0x33);
+
+	REQUIRE(memoryBus.FetchByte(0xC0FF) == 0x11);
+	REQUIRE(memoryBus.FetchByte(0xC100) == 0x22);
+	REQUIRE(memoryBus.FetchByte(0xD000) == 0x33);
+	REQUIRE(memoryBus.FetchByte(0xC0FF) == 0x11);
+
+	// Writes to the fetched page are visible straight away.
+	memoryBus.WriteByte(0xC0FE, 0x44);
+	REQUIRE(memoryBus.FetchByte(0xC0FE) == 0x44);
+}
+
+TEST_CASE_METHOD(TestFixtures::MemoryBusFixture, "Bank switches invalidate the fetched page")
+{
+	memoryBus.WriteByte(0x0000, 0x0A);
+	memoryBus.WriteByte(0x4000, 0x00);
+	memoryBus.WriteByte(0xA010, 0x11);
+	memoryBus.WriteByte(0x4000, 0x01);
+	memoryBus.WriteByte(0xA010, 0x22);
+
+	REQUIRE(memoryBus.FetchByte(0xA010) == 0x22);
+
+	memoryBus.WriteByte(0x4000, 0x00);
+	REQUIRE(memoryBus.FetchByte(0xA010) == 0x11);
+
+	memoryBus.WriteByte(0x4000, 0x01);
+	REQUIRE(memoryBus.FetchByte(0xA010) == 0x22);
+}
+
+TEST_CASE_METHOD(TestFixtures::MemoryBusFixture, "Writes mark the written pages dirty")
+{
+	for (bool pageTablesEnabled : { true, false })
+	{
+		DYNAMIC_SECTION("Page tables enabled: " << pageTablesEnabled)
+		{
+			memoryBus.SetPageTablesEnabled(pageTablesEnabled);
+
+			GameBoy::DirtyPages& workRamPages = memoryBus.GetWorkRamDirtyPages();
+			GameBoy::DirtyPages& cartridgeRamPages = cartridge.GetRamDirtyPages();
+
+			REQUIRE_FALSE(workRamPages.Any());
+			REQUIRE_FALSE(cartridgeRamPages.Any());
+
+			// Work RAM bank 0 starts at page 0, the switchable bank 1 at page 16.
+			memoryBus.WriteByte(0xC1FF, 0x11);
+			memoryBus.WriteByte(0xD000, 0x22);
+
+			std::vector<size_t> dirty;
+			workRamPages.ForEachDirtyPage([&dirty](size_t page) { dirty.push_back(page); });
+			REQUIRE(dirty == std::vector<size_t> { 0x01, 0x10 });
+
+			// Reads and control register writes do not mark anything.
+			memoryBus.ReadByte(0xC300);
+			memoryBus.WriteByte(0x0000, 0x0A);
+			memoryBus.WriteByte(0x4000, 0x02);
+			REQUIRE_FALSE(cartridgeRamPages.Any());
+
+			// RAM bank 2 starts at page 64 of the cartridge RAM.
+			memoryBus.WriteByte(0xA310, 0x33);
+			REQUIRE(cartridgeRamPages.IsDirty(0x43));
+			REQUIRE_FALSE(cartridgeRamPages.IsDirty(0x03));
+
+			workRamPages.Clear();
+			cartridgeRamPages.Clear();
+			REQUIRE_FALSE(workRamPages.Any());
+			REQUIRE_FALSE(cartridgeRamPages.Any());
+		}
+	}
+}
+
+TEST_CASE("Dirty pages are visited in ascending order")
+{
+	GameBoy::DirtyPages pages(200 * GameBoy::memoryPageSize);
+
+	// Spread over the first three words, marked out of order and one of them twice.
+	for (const size_t page : { 130, 3, 64, 63, 0, 129, 3 })
+		pages.Mark(page * GameBoy::memoryPageSize + 1);
+
+	std::vector<size_t> dirty;
+	pages.ForEachDirtyPage([&dirty](size_t page) { dirty.push_back(page); });
+	REQUIRE(dirty == std::vector<size_t> { 0, 3, 63, 64, 129, 130 });
+}
+
+TEST_CASE("MarkAll only marks the tracked pages of a partial last word")
+{
+	// 70 pages fill one word and 6 bits of the next one.
+	GameBoy::DirtyPages pages(70 * GameBoy::memoryPageSize);
+
+	REQUIRE(pages.PageCount() == 70);
+	pages.MarkAll();
+
+	std::vector<size_t> dirty;
+	pages.ForEachDirtyPage([&dirty](size_t page) { dirty.push_back(page); });
+	REQUIRE(dirty.size() == 70);
+	REQUIRE(dirty.front() == 0);
+	REQUIRE(dirty.back() == 69);
+	REQUIRE(pages.IsDirty(69));
+	REQUIRE_FALSE(pages.IsDirty(70));
+
+	pages.Clear();
+	REQUIRE_FALSE(pages.Any());
+}
@@ -1,72 +1,9 @@
 #define CATCH_CONFIG_MAIN
 #include <catch2/catch_test_macros.hpp>
-#include "play-man/gameboy/cpu/Cpu.hpp"
-#include "play-man/gameboy/memory/MemoryBus.hpp"
-
-#define GB_ROM_PATH "./test-data/custom_gb_test_roms/"
+#include "GameBoyCpuFixture.hpp"
 
 constexpr uint16_t interruptAddress = 0xFFFF;
 
-namespace TestFixtures
-{
-	/**
-	 * @brief
-	 */
-	struct GameBoyCpuFixture
-	{
-		GameBoyCpuFixture()
-			: cpu(GameBoy::MakeCartridge(GB_ROM_PATH "test_rom.gb"))
-			, memoryBus(cpu.memoryBus)
-			, AF(cpu.core.AF)
-			, BC(cpu.core.BC)
-			, DE(cpu.core.DE)
-			, HL(cpu.core.HL)
-			, SP(cpu.core.SP)
-			, PC(cpu.core.PC)
-			, IE(cpu.core.IE)
-		{
-			ClearRegisters();
-		}
-
-		GameBoy::Cpu 		cpu;
-        GameBoy::MemoryBus& memoryBus;
-		GameBoy::Register&	AF;
-        GameBoy::Register&	BC;
-        GameBoy::Register&	DE;
-        GameBoy::Register&	HL;
-        GameBoy::Register&	SP;
-        GameBoy::Register&	PC;
-        uint8_t&			IE;
-
-		size_t ExecuteInstruction(GameBoy::PrefixedOpCode op)
-		{
-			return cpu.prefixedInstructions.at(op)(&cpu);
-		}
-
-		void ClearRegisters()
-		{
-			AF.SetValue(0x0000);
-			BC.SetValue(0x0000);
-			DE.SetValue(0x0000);
-			HL.SetValue(0x0000);
-			SP.SetValue(0x0000);
-			PC.SetValue(0x0000);
-			IE = 0x00;
-		}
-
-		void PrintRegs()
-		{
-			std::cout << "Register AF: 0x" << std::setfill('0') << std::setw(2) << std::hex << static_cast<uint16_t>(AF.HighByte()) << "'" << std::setfill('0') << std::setw(2) << std::hex << static_cast<uint16_t>(AF.LowByte()) << std::endl;
-			std::cout << "Register BC: 0x" << std::setfill('0') << std::setw(2) << std::hex << static_cast<uint16_t>(BC.HighByte()) << "'" << std::setfill('0') << std::setw(2) << std::hex << static_cast<uint16_t>(BC.LowByte()) << std::endl;
-			std::cout << "Register DE: 0x" << std::setfill('0') << std::setw(2) << std::hex << static_cast<uint16_t>(DE.HighByte()) << "'" << std::setfill('0') << std::setw(2) << std::hex << static_cast<uint16_t>(DE.LowByte()) << std::endl;
-			std::cout << "Register HL: 0x" << std::setfill('0') << std::setw(2) << std::hex << static_cast<uint16_t>(HL.HighByte()) << "'" << std::setfill('0') << std::setw(2) << std::hex << static_cast<uint16_t>(HL.LowByte()) << std::endl;
-			std::cout << "Register SP: 0x" << std::setfill('0') << std::setw(2) << std::hex << static_cast<uint16_t>(SP.HighByte()) << "'" << std::setfill('0') << std::setw(2) << std::hex << static_cast<uint16_t>(SP.LowByte()) << std::endl;
-			std::cout << "Register PC: 0x" << std::setfill('0') << std::setw(2) << std::hex << static_cast<uint16_t>(PC.HighByte()) << "'" << std::setfill('0') << std::setw(2) << std::hex << static_cast<uint16_t>(PC.LowByte()) << std::endl;
-			std::cout << "Register IE: 0x" << std::setfill('0') << std::setw(2) << std::hex << static_cast<uint16_t>(IE) << std::endl;
-		}
-	};
-}
-
 TEST_CASE_METHOD(TestFixtures::GameBoyCpuFixture, "RLC_B, 0xCB00")
 {
 	ClearRegisters();
@@ -0,0 +1,86 @@
+#include <catch2/catch_test_macros.hpp>
+#include "play-man/gameboy/scheduler/Scheduler.hpp"
+
+#include <vector>
+
+TEST_CASE("Scheduler runs due events in order of their deadline")
+{
+	GameBoy::Scheduler scheduler;
+	std::vector<GameBoy::SchedulerEvent> fired;
+
+	for (const auto event : {GameBoy::SchedulerEvent::TimerOverflow, GameBoy::SchedulerEvent::LcdModeChange, GameBoy::SchedulerEvent::DmaEnd})
+		scheduler.SetHandler(event, [&fired, event](size_t) { fired.push_back(event); });
+
+	scheduler.Schedule(GameBoy::SchedulerEvent::TimerOverflow, 30);
+	scheduler.Schedule(GameBoy::SchedulerEvent::LcdModeChange, 10);
+	scheduler.Schedule(GameBoy::SchedulerEvent::DmaEnd, 20);
+
+	REQUIRE(scheduler.NextDeadline() == 10);
+
+	scheduler.RunDueEvents(9);
+
+	REQUIRE(fired.empty());
+
+	scheduler.RunDueEvents(25);
+
+	REQUIRE(fired == std::vector { GameBoy::SchedulerEvent::LcdModeChange, GameBoy::SchedulerEvent::DmaEnd });
+	REQUIRE(scheduler.NextDeadline() == 30);
+	REQUIRE(scheduler.Deadline(GameBoy::SchedulerEvent::DmaEnd) == GameBoy::Scheduler::notScheduled);
+}
+
+TEST_CASE("Scheduler replaces and cancels pending events")
+{
+	GameBoy::Scheduler scheduler;
+	size_t timesFired = 0;
+
+	scheduler.SetHandler(GameBoy::SchedulerEvent::SerialTransferDone, [&timesFired](size_t) { timesFired++; });
+
+	scheduler.Schedule(GameBoy::SchedulerEvent::SerialTransferDone, 10);
+	scheduler.Schedule(GameBoy::SchedulerEvent::SerialTransferDone, 50);
+
+	REQUIRE(scheduler.NextDeadline() == 50);
+
+	scheduler.RunDueEvents(100);
+
+	REQUIRE(timesFired == 1);
+
+	scheduler.Schedule(GameBoy::SchedulerEvent::SerialTransferDone, 150);
+	scheduler.Cancel(GameBoy::SchedulerEvent::SerialTransferDone);
+	scheduler.RunDueEvents(200);
+
+	REQUIRE(timesFired == 1);
+	REQUIRE(scheduler.NextDeadline() == GameBoy::Scheduler::notScheduled);
+
+	// Rescheduling many times does not keep stale entries around.
+	for (size_t deadline = 1000; deadline > 0; deadline--)
+		scheduler.Schedule(GameBoy::SchedulerEvent::SerialTransferDone, 300 + deadline);
+
+	REQUIRE(scheduler.NextDeadline() == 301);
+
+	scheduler.RunDueEvents(2000);
+
+	REQUIRE(timesFired == 2);
+}
+
+TEST_CASE("Scheduler runs events rescheduled by their handler")
+{
+	GameBoy::Scheduler scheduler;
+	std::vector<size_t> deadlines;
+
+	scheduler.SetHandler(GameBoy::SchedulerEvent::RealTimeClockTick, [&](size_t deadline)
+	{
+		deadlines.push_back(deadline);
+		scheduler.Schedule(GameBoy::SchedulerEvent::RealTimeClockTick, deadline + 4);
+	});
+	scheduler.Schedule(GameBoy::SchedulerEvent::RealTimeClockTick, 4);
+	scheduler.RunDueEvents(13);
+
+	REQUIRE(deadlines == std::vector<size_t> { 4, 8, 12 });
+	REQUIRE(scheduler.NextDeadline() == 16);
+}
+
+TEST_CASE("Scheduler has a slot for every event")
+{
+	STATIC_REQUIRE(GameBoy::numberOfSchedulerEvents == 5);
+	STATIC_REQUIRE(GameBoy::GetEnumAsValue(GameBoy::SchedulerEvent::RealTimeClockTick) == GameBoy::numberOfSchedulerEvents - 1);
+}
@@ -0,0 +1,86 @@
+#include <catch2/catch_test_macros.hpp>
+#include "play-man/gameboy/timer/Timer.hpp"
+#include "play-man/gameboy/memory/MemoryBusDefines.hpp"
+
+namespace TestFixtures
+{
+	/**
+	 * @brief A timer running on a cycle counter the test advances by hand.
+	 */
+	struct TimerFixture
+	{
+		GameBoy::CpuCore	core;
+		GameBoy::Scheduler	scheduler;
+		size_t				cycles = 1000;
+		GameBoy::Timer		timer { core, scheduler, cycles };
+
+		bool TimerInterruptRequested() const
+		{
+			return (core.GetInterruptFlags() & static_cast<uint8_t>(GameBoy::Interrupt::Timer)) != 0;
+		}
+	};
+}
+
+TEST_CASE_METHOD(TestFixtures::TimerFixture, "Timer divider counts every 64 cycles")
+{
+	REQUIRE(timer.ReadByte(dividerAddress) == 0xAB);
+
+	// The counter starts at 0x2AF3, 13 cycles before DIV changes.
+	cycles += 12;
+	REQUIRE(timer.ReadByte(dividerAddress) == 0xAB);
+	cycles += 1;
+	REQUIRE(timer.ReadByte(dividerAddress) == 0xAC);
+
+	// Writing any value resets it.
+	timer.WriteByte(dividerAddress, 0x55);
+	REQUIRE(timer.ReadByte(dividerAddress) == 0x00);
+	cycles += 64 * 3 + 63;
+	REQUIRE(timer.ReadByte(dividerAddress) == 0x03);
+}
+
+TEST_CASE_METHOD(TestFixtures::TimerFixture, "Timer catches up on the cycles passed since the last access")
+{
+	timer.WriteByte(dividerAddress, 0x00);
+	timer.WriteByte(timerModuloAddress, 0x10);
+	timer.WriteByte(timerCounterAddress, 0xFE);
+	timer.WriteByte(timerControlAddress, 0b101); // Every 4 cycles.
+
+	REQUIRE(timer.ReadByte(timerControlAddress) == 0b1111'1101);
+	REQUIRE(scheduler.Deadline(GameBoy::SchedulerEvent::TimerOverflow) == cycles + 8);
+
+	cycles += 7;
+	REQUIRE(timer.ReadByte(timerCounterAddress) == 0xFF);
+	REQUIRE_FALSE(TimerInterruptRequested());
+
+	cycles += 1;
+	REQUIRE(timer.ReadByte(timerCounterAddress) == 0x10);
+	REQUIRE(TimerInterruptRequested());
+
+	// Thousands of cycles at once, overflowing every (0x100 - 0x10) * 4 cycles.
+	core.SetInterruptFlags(0);
+	cycles += (0x100 - 0x10) * 4 * 10 + 4 * 3;
+	REQUIRE(timer.ReadByte(timerCounterAddress) == 0x13);
+	REQUIRE(TimerInterruptRequested());
+
+	// Disabled it keeps its value.
+	timer.WriteByte(timerControlAddress, 0b001);
+	cycles += 1000;
+	REQUIRE(timer.ReadByte(timerCounterAddress) == 0x13);
+	REQUIRE(scheduler.Deadline(GameBoy::SchedulerEvent::TimerOverflow) == GameBoy::Scheduler::notScheduled);
+}
+
+TEST_CASE_METHOD(TestFixtures::TimerFixture, "Timer requests its interrupt through the scheduled overflow")
+{
+	timer.WriteByte(dividerAddress, 0x00);
+	timer.WriteByte(timerCounterAddress, 0xFF);
+	timer.WriteByte(timerControlAddress, 0b100); // Every 256 cycles.
+
+	cycles += 255;
+	scheduler.RunDueEvents(cycles);
+	REQUIRE_FALSE(TimerInterruptRequested());
+
+	cycles += 3;
+	scheduler.RunDueEvents(cycles);
+	REQUIRE(TimerInterruptRequested());
+	REQUIRE(scheduler.Deadline(GameBoy::SchedulerEvent::TimerOverflow) == cycles - 2 + 256 * 0x100);
+}
@@ -49,6 +49,8 @@ TEST_CASE_METHOD(TestFixtures::PlayManSettingsFixture, "Generate Default setting
 {
 	REQUIRE(settings->logDirectory == settings->defaultLogDirectory);
 	REQUIRE(settings->logLevel == settings->defaultLogLevel);
+	REQUIRE(settings->timingAccuracy == settings->defaultTimingAccuracy);
+	REQUIRE(settings->saveFlushIntervalFrames == settings->defaultSaveFlushIntervalFrames);
 }
 
 TEST_CASE_METHOD(TestFixtures::PlayManSettingsFixture, "Load partial settings")
@@ -62,6 +64,8 @@ TEST_CASE_METHOD(TestFixtures::PlayManSettingsFixture, "Saving settings")
 {
 	settings->logLevel = Logger::LogLevel::Debug;
 	settings->logDirectory = "unitTestLogDirectory";
+	settings->timingAccuracy = TimingAccuracy::Accurate;
+	settings->saveFlushIntervalFrames = 0;
 
 	constexpr auto fileName = "savingSettings.json";
 
@@ -71,6 +75,8 @@ TEST_CASE_METHOD(TestFixtures::PlayManSettingsFixture, "Saving settings")
 	
 	REQUIRE(newSettings->logLevel == Logger::LogLevel::Debug);
 	REQUIRE(newSettings->logDirectory == "unitTestLogDirectory");
+	REQUIRE(newSettings->timingAccuracy == TimingAccuracy::Accurate);
+	REQUIRE(newSettings->saveFlushIntervalFrames == 0);
 }
 
 TEST_CASE_METHOD(TestFixtures::PlayManSettingsFixture, "Reset to default settings")
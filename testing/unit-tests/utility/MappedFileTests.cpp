@@ -0,0 +1,51 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch_test_macros.hpp>
+
+#include "play-man/utility/MappedFile.hpp"
+
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#define TEST_FILE_PATH "./test-data/custom_gb_test_roms/test_rom.gb"
+
+static std::vector<uint8_t> ReadWholeFile(const char* filePath)
+{
+	std::ifstream file(filePath, std::ios::binary);
+	return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+////////////////
+// MappedFile //
+////////////////
+
+TEST_CASE("Mapped file contains the file contents")
+{
+	const auto expected = ReadWholeFile(TEST_FILE_PATH);
+	const Utility::MappedFile file(TEST_FILE_PATH);
+
+#if defined(__linux__) || defined(__APPLE__)
+	REQUIRE(file.IsMapped());
+#endif
+	REQUIRE(file.size() == expected.size());
+	REQUIRE(std::vector<uint8_t>(file.data(), file.data() + file.size()) == expected);
+}
+
+TEST_CASE("Moving a mapped file keeps its data")
+{
+	const auto expected = ReadWholeFile(TEST_FILE_PATH);
+	Utility::MappedFile file(TEST_FILE_PATH);
+	const uint8_t* data = file.data();
+
+	Utility::MappedFile moved(std::move(file));
+
+	REQUIRE(file.data() == nullptr);
+	REQUIRE(file.size() == 0);
+	REQUIRE(moved.data() == data);
+	REQUIRE(std::vector<uint8_t>(moved.data(), moved.data() + moved.size()) == expected);
+}
+
+TEST_CASE("Mapping a non existing file throws")
+{
+	REQUIRE_THROWS_AS(Utility::MappedFile("./test-data/this_file_does_not_exist.gb"), std::runtime_error);
+}